@@ -0,0 +1,307 @@
+#ifndef ARRAY_ALIGNED_ARRAY_H
+#define ARRAY_ALIGNED_ARRAY_H
+
+#include "array.h"
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+#include <utility>
+
+const size_t kSimdAlignment = 64;
+
+// Storage is aligned to Align and padded to a whole number of Align-byte vectors, so the bulk operations below run
+// over complete aligned vectors without a scalar tail. Padding elements are value-initialized and take part in the
+// bulk operations; Fill and floating point division reset them to zero afterwards, so integer operations on them
+// cannot overflow. Multiplying a floating point array by an infinite scalar still leaves NaN there. They are never
+// observed through the interface.
+template <class T, int32_t N, size_t Align = kSimdAlignment>
+struct AlignedArray {
+    static_assert(std::has_single_bit(Align) && Align >= alignof(T), "BadAlignment");
+
+    static constexpr int32_t kLanes = Align % sizeof(T) == 0 ? static_cast<int32_t>(Align / sizeof(T)) : 1;
+    static constexpr int32_t kPaddedSize = (N + kLanes - 1) / kLanes * kLanes;
+
+    using Iterator = T*;
+    using ConstIterator = const T*;
+    using value_type = T;                  //  NOLINT
+    using iterator = Iterator;             //  NOLINT
+    using const_iterator = ConstIterator;  //  NOLINT
+
+    alignas(Align) T buffer_[kPaddedSize]{};
+
+    constexpr const T& operator[](const int32_t&) const;
+    constexpr T& operator[](const int32_t&);
+    constexpr T At(const int32_t&) const;
+    constexpr T& At(const int32_t&);
+    constexpr T Back() const;
+    constexpr T& Back();
+    constexpr T Front() const;
+    constexpr T& Front();
+    constexpr T* Data();
+    constexpr T const* Data() const;
+    constexpr int32_t Size() const;
+    constexpr int32_t PaddedSize() const;
+    constexpr bool Empty() const;
+    constexpr Iterator begin();              //  NOLINT
+    constexpr Iterator end();                //  NOLINT
+    constexpr ConstIterator begin() const;   //  NOLINT
+    constexpr ConstIterator end() const;     //  NOLINT
+    constexpr ConstIterator cbegin() const;  //  NOLINT
+    constexpr ConstIterator cend() const;    //  NOLINT
+    constexpr void Fill(const T&);
+    constexpr void Swap(AlignedArray<T, N, Align>&);
+    constexpr void swap(AlignedArray<T, N, Align>&);  //  NOLINT
+    constexpr AlignedArray<T, N, Align>& operator+=(const AlignedArray<T, N, Align>&);
+    constexpr AlignedArray<T, N, Align>& operator-=(const AlignedArray<T, N, Align>&);
+    constexpr AlignedArray<T, N, Align>& operator*=(const AlignedArray<T, N, Align>&);
+    constexpr AlignedArray<T, N, Align>& operator/=(const AlignedArray<T, N, Align>&);
+    constexpr AlignedArray<T, N, Align>& operator*=(const T&);
+    constexpr AlignedArray<T, N, Align>& operator/=(const T&);
+    constexpr std::weak_ordering operator<=>(const AlignedArray<T, N, Align>&) const;
+    constexpr bool operator==(const AlignedArray<T, N, Align>&) const;
+};
+
+namespace aligned_array_detail {
+
+// Applies function(f[i], s[i]) to the whole padded storage. The trip count is a multiple of the vector width and
+// both pointers are aligned, so the compiler emits aligned vector code without a remainder loop.
+template <class T, int32_t N, size_t Align, class U, class Function>
+constexpr void ForEachLane(AlignedArray<T, N, Align>& f, U* s, Function function) {
+    T* first = std::assume_aligned<Align>(f.buffer_);
+    U* second = std::assume_aligned<Align>(s);
+#pragma GCC ivdep
+    for (int32_t i = 0; i < AlignedArray<T, N, Align>::kPaddedSize; ++i) {
+        function(first[i], second[i]);
+    }
+}
+
+template <class T, int32_t N, size_t Align, class Function>
+constexpr void ForEachLane(AlignedArray<T, N, Align>& f, Function function) {
+    T* first = std::assume_aligned<Align>(f.buffer_);
+#pragma GCC ivdep
+    for (int32_t i = 0; i < AlignedArray<T, N, Align>::kPaddedSize; ++i) {
+        function(first[i]);
+    }
+}
+
+}  // namespace aligned_array_detail
+
+template <class T, int32_t N, size_t Align>
+constexpr const T& AlignedArray<T, N, Align>::operator[](const int32_t& i) const {
+    return buffer_[i];
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr T& AlignedArray<T, N, Align>::operator[](const int32_t& i) {
+    return buffer_[i];
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr T AlignedArray<T, N, Align>::At(const int32_t& i) const {
+    if (i < 0 || i >= N) {
+        throw ArrayOutOfRange{};
+    }
+    return buffer_[i];
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr T& AlignedArray<T, N, Align>::At(const int32_t& i) {
+    if (i < 0 || i >= N) {
+        throw ArrayOutOfRange{};
+    }
+    return buffer_[i];
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr T& AlignedArray<T, N, Align>::Front() {
+    return buffer_[0];
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr T AlignedArray<T, N, Align>::Front() const {
+    return buffer_[0];
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr T& AlignedArray<T, N, Align>::Back() {
+    return buffer_[N - 1];
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr T AlignedArray<T, N, Align>::Back() const {
+    return buffer_[N - 1];
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr T const* AlignedArray<T, N, Align>::Data() const {
+    return buffer_;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr T* AlignedArray<T, N, Align>::Data() {
+    return buffer_;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr int32_t AlignedArray<T, N, Align>::Size() const {
+    return N;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr int32_t AlignedArray<T, N, Align>::PaddedSize() const {
+    return kPaddedSize;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr bool AlignedArray<T, N, Align>::Empty() const {
+    return Size() == 0;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr typename AlignedArray<T, N, Align>::Iterator AlignedArray<T, N, Align>::begin() {  //  NOLINT
+    return buffer_;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr typename AlignedArray<T, N, Align>::Iterator AlignedArray<T, N, Align>::end() {  //  NOLINT
+    return buffer_ + N;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr typename AlignedArray<T, N, Align>::ConstIterator AlignedArray<T, N, Align>::begin() const {  //  NOLINT
+    return buffer_;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr typename AlignedArray<T, N, Align>::ConstIterator AlignedArray<T, N, Align>::end() const {  //  NOLINT
+    return buffer_ + N;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr typename AlignedArray<T, N, Align>::ConstIterator AlignedArray<T, N, Align>::cbegin() const {  //  NOLINT
+    return buffer_;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr typename AlignedArray<T, N, Align>::ConstIterator AlignedArray<T, N, Align>::cend() const {  //  NOLINT
+    return buffer_ + N;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr void AlignedArray<T, N, Align>::Fill(const T& value) {
+    T copy(value);
+    aligned_array_detail::ForEachLane(*this, [&copy](T& element) { element = copy; });
+    std::fill(buffer_ + N, buffer_ + kPaddedSize, T{});
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr void AlignedArray<T, N, Align>::Swap(AlignedArray<T, N, Align>& other) {
+    aligned_array_detail::ForEachLane(*this, other.buffer_, [](T& f, T& s) {
+        using std::swap;
+        swap(f, s);
+    });
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr void AlignedArray<T, N, Align>::swap(AlignedArray<T, N, Align>& other) {  //  NOLINT
+    Swap(other);
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr AlignedArray<T, N, Align>& AlignedArray<T, N, Align>::operator+=(const AlignedArray<T, N, Align>& other) {
+    aligned_array_detail::ForEachLane(*this, other.buffer_, [](T& f, const T& s) { f += s; });
+    return *this;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr AlignedArray<T, N, Align>& AlignedArray<T, N, Align>::operator-=(const AlignedArray<T, N, Align>& other) {
+    aligned_array_detail::ForEachLane(*this, other.buffer_, [](T& f, const T& s) { f -= s; });
+    return *this;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr AlignedArray<T, N, Align>& AlignedArray<T, N, Align>::operator*=(const AlignedArray<T, N, Align>& other) {
+    aligned_array_detail::ForEachLane(*this, other.buffer_, [](T& f, const T& s) { f *= s; });
+    return *this;
+}
+
+// Integer division by the zero padding would be undefined, so only floating point division covers the padding, and
+// the 0 / 0 it produces there is reset.
+template <class T, int32_t N, size_t Align>
+constexpr AlignedArray<T, N, Align>& AlignedArray<T, N, Align>::operator/=(const AlignedArray<T, N, Align>& other) {
+    if constexpr (std::is_floating_point_v<T>) {
+        aligned_array_detail::ForEachLane(*this, other.buffer_, [](T& f, const T& s) { f /= s; });
+        std::fill(buffer_ + N, buffer_ + kPaddedSize, T{});
+    } else {
+        for (int32_t i = 0; i < N; ++i) {
+            buffer_[i] /= other.buffer_[i];
+        }
+    }
+    return *this;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr AlignedArray<T, N, Align>& AlignedArray<T, N, Align>::operator*=(const T& value) {
+    T copy(value);
+    aligned_array_detail::ForEachLane(*this, [&copy](T& element) { element *= copy; });
+    return *this;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr AlignedArray<T, N, Align>& AlignedArray<T, N, Align>::operator/=(const T& value) {
+    T copy(value);
+    aligned_array_detail::ForEachLane(*this, [&copy](T& element) { element /= copy; });
+    if constexpr (std::is_floating_point_v<T>) {
+        std::fill(buffer_ + N, buffer_ + kPaddedSize, T{});
+    }
+    return *this;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr std::weak_ordering AlignedArray<T, N, Align>::operator<=>(const AlignedArray<T, N, Align>& other) const {
+    return LexicographicCompare(buffer_, N, other.buffer_, N);
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr bool AlignedArray<T, N, Align>::operator==(const AlignedArray<T, N, Align>& other) const {
+    return RangesEqual(buffer_, N, other.buffer_, N);
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr AlignedArray<T, N, Align> operator+(AlignedArray<T, N, Align> f, const AlignedArray<T, N, Align>& s) {
+    return f += s;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr AlignedArray<T, N, Align> operator-(AlignedArray<T, N, Align> f, const AlignedArray<T, N, Align>& s) {
+    return f -= s;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr AlignedArray<T, N, Align> operator*(AlignedArray<T, N, Align> f, const AlignedArray<T, N, Align>& s) {
+    return f *= s;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr AlignedArray<T, N, Align> operator/(AlignedArray<T, N, Align> f, const AlignedArray<T, N, Align>& s) {
+    return f /= s;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr AlignedArray<T, N, Align> operator*(AlignedArray<T, N, Align> f, const T& value) {
+    return f *= value;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr AlignedArray<T, N, Align> operator*(const T& value, AlignedArray<T, N, Align> f) {
+    return f *= value;
+}
+
+template <class T, int32_t N, size_t Align>
+constexpr AlignedArray<T, N, Align> operator/(AlignedArray<T, N, Align> f, const T& value) {
+    return f /= value;
+}
+
+#endif  // ARRAY_ALIGNED_ARRAY_H
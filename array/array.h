@@ -2,9 +2,17 @@
 #define ARRAY_ARRAY_H
 #define ARRAY_ARRAY_TRAITS_IMPLEMENTED
 
+#include <util/bulk_memory.h>
+#include <util/compare.h>
+#include <algorithm>
+#include <compare>
+#include <functional>
 #include <iterator>
+#include <numeric>
 #include <stdexcept>
 #include <cstdint>
+#include <type_traits>
+#include <utility>
 
 class ArrayOutOfRange : public std::out_of_range {
 public:
@@ -12,44 +20,60 @@ public:
     }
 };
 
+template <class T, int32_t N, int32_t... Dims>
+struct Array;
+
 template <class T, int32_t N>
-struct Array {
+struct Array<T, N> {
+    using Iterator = T*;
+    using ConstIterator = const T*;
+    using value_type = T;                  //  NOLINT
+    using iterator = Iterator;             //  NOLINT
+    using const_iterator = ConstIterator;  //  NOLINT
+
     T buffer_[N];
-    const T& operator[](const int32_t&) const;
-    T& operator[](const int32_t&);
-    T At(const int32_t&) const;
-    T& At(const int32_t&);
-    T Back() const;
-    T& Back();
-    T Front() const;
-    T& Front();
-    T* Data();
-    T const* Data() const;
-    int32_t Size() const;
-    bool Empty() const;
-    void Fill(const T&);
-    void Swap(Array<T, N>&);
-    void swap(Array<T, N>&);  //  NOLINT
-    bool operator>(const Array<T, N>&) const;
-    bool operator<(const Array<T, N>&) const;
-    bool operator==(const Array<T, N>&) const;
-    bool operator>=(const Array<T, N>&) const;
-    bool operator<=(const Array<T, N>&) const;
-    bool operator!=(const Array<T, N>&) const;
+    constexpr const T& operator[](const int32_t&) const;
+    constexpr T& operator[](const int32_t&);
+    constexpr T At(const int32_t&) const;
+    constexpr T& At(const int32_t&);
+    constexpr T Back() const;
+    constexpr T& Back();
+    constexpr T Front() const;
+    constexpr T& Front();
+    constexpr T* Data();
+    constexpr T const* Data() const;
+    constexpr int32_t Size() const;
+    constexpr bool Empty() const;
+    constexpr Iterator begin();              //  NOLINT
+    constexpr Iterator end();                //  NOLINT
+    constexpr ConstIterator begin() const;   //  NOLINT
+    constexpr ConstIterator end() const;     //  NOLINT
+    constexpr ConstIterator cbegin() const;  //  NOLINT
+    constexpr ConstIterator cend() const;    //  NOLINT
+    constexpr void Fill(const T&);
+    constexpr void Swap(Array<T, N>&);
+    constexpr void swap(Array<T, N>&);  //  NOLINT
+    constexpr std::weak_ordering operator<=>(const Array<T, N>&) const;
+    constexpr bool operator>(const Array<T, N>&) const;
+    constexpr bool operator<(const Array<T, N>&) const;
+    constexpr bool operator==(const Array<T, N>&) const;
+    constexpr bool operator>=(const Array<T, N>&) const;
+    constexpr bool operator<=(const Array<T, N>&) const;
+    constexpr bool operator!=(const Array<T, N>&) const;
 };
 
 template <class T, int32_t N>
-const T& Array<T, N>::operator[](const int32_t& i) const {
+constexpr const T& Array<T, N>::operator[](const int32_t& i) const {
     return buffer_[i];
 }
 
 template <class T, int32_t N>
-T& Array<T, N>::operator[](const int32_t& i) {
+constexpr T& Array<T, N>::operator[](const int32_t& i) {
     return buffer_[i];
 }
 
 template <class T, int32_t N>
-T Array<T, N>::At(const int32_t& i) const {
+constexpr T Array<T, N>::At(const int32_t& i) const {
     if (i < 0 || i >= N) {
         throw ArrayOutOfRange{};
     }
@@ -57,7 +81,7 @@ T Array<T, N>::At(const int32_t& i) const {
 }
 
 template <class T, int32_t N>
-T& Array<T, N>::At(const int32_t& i) {
+constexpr T& Array<T, N>::At(const int32_t& i) {
     if (i < 0 || i >= N) {
         throw ArrayOutOfRange{};
     }
@@ -65,140 +89,200 @@ T& Array<T, N>::At(const int32_t& i) {
 }
 
 template <class T, int32_t N>
-T& Array<T, N>::Front() {
+constexpr T& Array<T, N>::Front() {
     return buffer_[0];
 }
 
 template <class T, int32_t N>
-T Array<T, N>::Front() const {
+constexpr T Array<T, N>::Front() const {
     return buffer_[0];
 }
 
 template <class T, int32_t N>
-T& Array<T, N>::Back() {
+constexpr T& Array<T, N>::Back() {
     return buffer_[N - 1];
 }
 
 template <class T, int32_t N>
-T Array<T, N>::Back() const {
+constexpr T Array<T, N>::Back() const {
     return buffer_[N - 1];
 }
 
 template <class T, int32_t N>
-T const* Array<T, N>::Data() const {
+constexpr T const* Array<T, N>::Data() const {
     return buffer_;
 }
 
 template <class T, int32_t N>
-T* Array<T, N>::Data() {
+constexpr T* Array<T, N>::Data() {
     return buffer_;
 }
 
 template <class T, int32_t N>
-int32_t Array<T, N>::Size() const {
+constexpr int32_t Array<T, N>::Size() const {
     return N;
 }
 
 template <class T, int32_t N>
-bool Array<T, N>::Empty() const {
+constexpr bool Array<T, N>::Empty() const {
     return Size() == 0;
 }
 
 template <class T, int32_t N>
-void Array<T, N>::Fill(const T& value) {
-    for (int32_t i = 0; i < Size(); ++i) {
-        buffer_[i] = value;
-    }
+constexpr typename Array<T, N>::Iterator Array<T, N>::begin() {  //  NOLINT
+    return buffer_;
 }
 
 template <class T, int32_t N>
-void Array<T, N>::Swap(Array<T, N>& other) {
-    for (int32_t i = 0; i < Size(); ++i) {
-        T tmp = buffer_[i];
-        buffer_[i] = other.buffer_[i];
-        other.buffer_[i] = tmp;
-    }
+constexpr typename Array<T, N>::Iterator Array<T, N>::end() {  //  NOLINT
+    return buffer_ + N;
 }
 
 template <class T, int32_t N>
-void Array<T, N>::swap(Array<T, N>& other) {  //  NOLINT
-    Swap(other);
+constexpr typename Array<T, N>::ConstIterator Array<T, N>::begin() const {  //  NOLINT
+    return buffer_;
 }
 
 template <class T, int32_t N>
-bool Array<T, N>::operator>(const Array<T, N>& other) const {
-    for (int32_t i = 0; i < Size(); ++i) {
-        if (buffer_[i] < other.buffer_[i]) {
-            return false;
-        }
-        if (buffer_[i] > other.buffer_[i]) {
-            return true;
+constexpr typename Array<T, N>::ConstIterator Array<T, N>::end() const {  //  NOLINT
+    return buffer_ + N;
+}
+
+template <class T, int32_t N>
+constexpr typename Array<T, N>::ConstIterator Array<T, N>::cbegin() const {  //  NOLINT
+    return buffer_;
+}
+
+template <class T, int32_t N>
+constexpr typename Array<T, N>::ConstIterator Array<T, N>::cend() const {  //  NOLINT
+    return buffer_ + N;
+}
+
+template <class T, int32_t N>
+constexpr void Array<T, N>::Fill(const T& value) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (!std::is_constant_evaluated()) {
+            FillTrivial(buffer_, N, value);
+            return;
         }
     }
-    return false;
+    std::fill(buffer_, buffer_ + N, value);
 }
 
 template <class T, int32_t N>
-bool Array<T, N>::operator==(const Array<T, N>& other) const {
-    for (int32_t i = 0; i < Size(); ++i) {
-        if (buffer_[i] < other.buffer_[i]) {
-            return false;
-        }
-        if (buffer_[i] > other.buffer_[i]) {
-            return false;
+constexpr void Array<T, N>::Swap(Array<T, N>& other) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (!std::is_constant_evaluated()) {
+            SwapTrivial(buffer_, other.buffer_, N);
+            return;
         }
     }
-    return true;
+    std::swap_ranges(buffer_, buffer_ + N, other.buffer_);
+}
+
+template <class T, int32_t N>
+constexpr void Array<T, N>::swap(Array<T, N>& other) {  //  NOLINT
+    Swap(other);
 }
 
 template <class T, int32_t N>
-bool Array<T, N>::operator>=(const Array<T, N>& other) const {
-    return (*this > other) || (*this == other);
+constexpr std::weak_ordering Array<T, N>::operator<=>(const Array<T, N>& other) const {
+    return LexicographicCompare(buffer_, N, other.buffer_, N);
 }
 
 template <class T, int32_t N>
-bool Array<T, N>::operator<(const Array<T, N>& other) const {
-    return !(*this >= other);
+constexpr bool Array<T, N>::operator>(const Array<T, N>& other) const {
+    return (*this <=> other) > 0;
 }
 
 template <class T, int32_t N>
-bool Array<T, N>::operator<=(const Array<T, N>& other) const {
-    return !(*this > other);
+constexpr bool Array<T, N>::operator==(const Array<T, N>& other) const {
+    return RangesEqual(buffer_, N, other.buffer_, N);
 }
 
 template <class T, int32_t N>
-bool Array<T, N>::operator!=(const Array<T, N>& other) const {
+constexpr bool Array<T, N>::operator>=(const Array<T, N>& other) const {
+    return (*this <=> other) >= 0;
+}
+
+template <class T, int32_t N>
+constexpr bool Array<T, N>::operator<(const Array<T, N>& other) const {
+    return (*this <=> other) < 0;
+}
+
+template <class T, int32_t N>
+constexpr bool Array<T, N>::operator<=(const Array<T, N>& other) const {
+    return (*this <=> other) <= 0;
+}
+
+template <class T, int32_t N>
+constexpr bool Array<T, N>::operator!=(const Array<T, N>& other) const {
     return !(*this == other);
 }
 
+namespace array_detail {
+
+template <class T, int32_t N, class Generator, size_t... I>
+constexpr Array<T, N> MakeArray(Generator& generator, std::index_sequence<I...>) {
+    return {{generator(static_cast<int32_t>(I))...}};
+}
+
+}  // namespace array_detail
+
+// Array whose i-th element is generator(i); with a constexpr generator the table is built at compile time:
+// constexpr auto kSquares = MakeArray<int, 16>([](int32_t i) { return i * i; });
+template <class T, int32_t N, class Generator>
+constexpr Array<T, N> MakeArray(Generator generator) {
+    return array_detail::MakeArray<T, N>(generator, std::make_index_sequence<N>{});
+}
+
+template <class T, int32_t N, class Compare = std::less<>>
+constexpr void Sort(Array<T, N>& array, Compare compare = Compare{}) {
+    std::sort(array.begin(), array.end(), compare);
+}
+
+// Index of the first element equal to value, or -1.
+template <class T, int32_t N, class U>
+constexpr int32_t Find(const Array<T, N>& array, const U& value) {
+    auto it = std::find(array.begin(), array.end(), value);
+    return it == array.end() ? -1 : static_cast<int32_t>(it - array.begin());
+}
+
+template <class T, int32_t N, class U, class BinaryOperation = std::plus<>>
+constexpr U Accumulate(const Array<T, N>& array, U init, BinaryOperation operation = BinaryOperation{}) {
+    return std::accumulate(array.begin(), array.end(), std::move(init), operation);
+}
+
 template <class T, int32_t N>
-int32_t GetSize(const T (&)[N]) {
+constexpr int32_t GetSize(const T (&)[N]) {
     return N;
 }
 
 template <class T>
-int32_t GetSize(const T&) {
+constexpr int32_t GetSize(const T&) {
     return 0;
 }
 
 template <class T>
-int32_t GetRank(const T&) {
+constexpr int32_t GetRank(const T&) {
     return 0;
 }
 
 template <class T, int32_t N>
-int32_t GetRank(const T (&other)[N]) {
+constexpr int32_t GetRank(const T (&other)[N]) {
     return 1 + GetRank(other[0]);
 }
 
 template <class T>
-int32_t GetNumElements(const T&) {
+constexpr int32_t GetNumElements(const T&) {
     return 1;
 }
 
 template <class T, int32_t N>
-int32_t GetNumElements(const T (&other)[N]) {
+constexpr int32_t GetNumElements(const T (&other)[N]) {
     return N * GetNumElements(other[0]);
 }
 
+#include "md_array.h"
+
 #endif  // ARRAY_ARRAY_H
\ No newline at end of file
@@ -0,0 +1,381 @@
+#ifndef ARRAY_INPLACE_VECTOR_H
+#define ARRAY_INPLACE_VECTOR_H
+
+#include "array.h"
+#include <algorithm>
+#include <compare>
+#include <cstddef>
+#include <memory>
+#include <stdexcept>
+#include <type_traits>
+#include <utility>
+
+class InplaceVectorOverflow : public std::length_error {
+public:
+    InplaceVectorOverflow() : std::length_error("InplaceVectorOverflow") {
+    }
+};
+
+// Vector with the capacity N fixed at compile time and the elements stored inside the object (in an Array), so it
+// never touches the heap. Only the first Size() slots hold live objects. For trivially copyable T the copy and
+// move operations and the destructor stay trivial.
+template <class T, int32_t N>
+class InplaceVector {
+    union Storage {
+        Array<T, N> array_;
+
+        constexpr Storage() {
+        }
+        constexpr ~Storage()
+            requires std::is_trivially_destructible_v<T>
+        = default;
+        constexpr ~Storage() {
+        }
+    };
+
+    Storage storage_;
+    size_t size_;
+
+    constexpr T* Slots();
+    constexpr const T* Slots() const;
+
+public:
+    using Iterator = T*;
+    using ConstIterator = const T*;
+    using value_type = T;                  //  NOLINT
+    using iterator = Iterator;             //  NOLINT
+    using const_iterator = ConstIterator;  //  NOLINT
+
+    constexpr InplaceVector();
+    constexpr explicit InplaceVector(const size_t&);
+    constexpr InplaceVector(const size_t&, const T&);
+    constexpr InplaceVector(const InplaceVector<T, N>&)
+        requires std::is_trivially_copy_constructible_v<T>
+    = default;
+    constexpr InplaceVector(const InplaceVector<T, N>&);
+    constexpr InplaceVector(InplaceVector<T, N>&&) noexcept
+        requires std::is_trivially_move_constructible_v<T>
+    = default;
+    constexpr InplaceVector(InplaceVector<T, N>&&) noexcept(std::is_nothrow_move_constructible_v<T>);
+    constexpr InplaceVector<T, N>& operator=(const InplaceVector<T, N>&)
+        requires std::is_trivially_copy_assignable_v<T> && std::is_trivially_copy_constructible_v<T>
+    = default;
+    constexpr InplaceVector<T, N>& operator=(const InplaceVector<T, N>&);
+    constexpr InplaceVector<T, N>& operator=(InplaceVector<T, N>&&) noexcept
+        requires std::is_trivially_move_assignable_v<T> && std::is_trivially_move_constructible_v<T>
+    = default;
+    constexpr InplaceVector<T, N>& operator=(InplaceVector<T, N>&&) noexcept(std::is_nothrow_move_assignable_v<T>);
+    constexpr ~InplaceVector()
+        requires std::is_trivially_destructible_v<T>
+    = default;
+    constexpr ~InplaceVector();
+    constexpr InplaceVector<T, N>& Clear();
+    constexpr InplaceVector<T, N>& PushBack(const T&);
+    constexpr InplaceVector<T, N>& PushBack(T&&);
+    constexpr bool TryPushBack(const T&);
+    template <class... Args>
+    constexpr T& EmplaceBack(Args&&...);
+    constexpr InplaceVector<T, N>& PopBack();
+    constexpr InplaceVector<T, N>& Resize(const size_t&);
+    constexpr InplaceVector<T, N>& Resize(const size_t&, const T&);
+    constexpr InplaceVector<T, N>& Swap(InplaceVector<T, N>&);
+    constexpr T operator[](const size_t&) const;
+    constexpr T& operator[](const size_t&);
+    constexpr T At(const size_t&) const;
+    constexpr T& At(const size_t&);
+    constexpr T Front() const;
+    constexpr T& Front();
+    constexpr T Back() const;
+    constexpr T& Back();
+    constexpr bool Empty() const;
+    constexpr size_t Size() const;
+    constexpr size_t Capacity() const;
+    constexpr T* Data();
+    constexpr const T* Data() const;
+    constexpr Iterator begin();              //  NOLINT
+    constexpr Iterator end();                //  NOLINT
+    constexpr ConstIterator begin() const;   //  NOLINT
+    constexpr ConstIterator end() const;     //  NOLINT
+    constexpr ConstIterator cbegin() const;  //  NOLINT
+    constexpr ConstIterator cend() const;    //  NOLINT
+    constexpr std::weak_ordering operator<=>(const InplaceVector<T, N>&) const;
+    constexpr bool operator==(const InplaceVector<T, N>&) const;
+};
+
+template <class T, int32_t N>
+constexpr T* InplaceVector<T, N>::Slots() {
+    return storage_.array_.buffer_;
+}
+
+template <class T, int32_t N>
+constexpr const T* InplaceVector<T, N>::Slots() const {
+    return storage_.array_.buffer_;
+}
+
+template <class T, int32_t N>
+constexpr InplaceVector<T, N>::InplaceVector() : size_(0) {
+}
+
+template <class T, int32_t N>
+constexpr InplaceVector<T, N>::InplaceVector(const size_t& count) : InplaceVector() {
+    Resize(count);
+}
+
+template <class T, int32_t N>
+constexpr InplaceVector<T, N>::InplaceVector(const size_t& count, const T& value) : InplaceVector() {
+    Resize(count, value);
+}
+
+template <class T, int32_t N>
+constexpr InplaceVector<T, N>::InplaceVector(const InplaceVector<T, N>& other) : InplaceVector() {
+    for (; size_ < other.size_; ++size_) {
+        std::construct_at(Slots() + size_, other.Slots()[size_]);
+    }
+}
+
+template <class T, int32_t N>
+constexpr InplaceVector<T, N>::InplaceVector(InplaceVector<T, N>&& other) noexcept(
+    std::is_nothrow_move_constructible_v<T>)
+    : InplaceVector() {
+    for (; size_ < other.size_; ++size_) {
+        std::construct_at(Slots() + size_, std::move(other.Slots()[size_]));
+    }
+}
+
+template <class T, int32_t N>
+constexpr InplaceVector<T, N>& InplaceVector<T, N>::operator=(const InplaceVector<T, N>& other) {
+    if (this != &other) {
+        size_t common = std::min(size_, other.size_);
+        std::copy(other.Slots(), other.Slots() + common, Slots());
+        for (; size_ < other.size_; ++size_) {
+            std::construct_at(Slots() + size_, other.Slots()[size_]);
+        }
+        while (size_ > other.size_) {
+            PopBack();
+        }
+    }
+    return *this;
+}
+
+template <class T, int32_t N>
+constexpr InplaceVector<T, N>& InplaceVector<T, N>::operator=(InplaceVector<T, N>&& other) noexcept(
+    std::is_nothrow_move_assignable_v<T>) {
+    if (this != &other) {
+        size_t common = std::min(size_, other.size_);
+        std::move(other.Slots(), other.Slots() + common, Slots());
+        for (; size_ < other.size_; ++size_) {
+            std::construct_at(Slots() + size_, std::move(other.Slots()[size_]));
+        }
+        while (size_ > other.size_) {
+            PopBack();
+        }
+    }
+    return *this;
+}
+
+template <class T, int32_t N>
+constexpr InplaceVector<T, N>::~InplaceVector() {
+    Clear();
+}
+
+template <class T, int32_t N>
+constexpr InplaceVector<T, N>& InplaceVector<T, N>::Clear() {
+    std::destroy(Slots(), Slots() + size_);
+    size_ = 0;
+    return *this;
+}
+
+template <class T, int32_t N>
+constexpr InplaceVector<T, N>& InplaceVector<T, N>::PushBack(const T& value) {
+    EmplaceBack(value);
+    return *this;
+}
+
+template <class T, int32_t N>
+constexpr InplaceVector<T, N>& InplaceVector<T, N>::PushBack(T&& value) {
+    EmplaceBack(std::move(value));
+    return *this;
+}
+
+template <class T, int32_t N>
+constexpr bool InplaceVector<T, N>::TryPushBack(const T& value) {
+    if (size_ == static_cast<size_t>(N)) {
+        return false;
+    }
+    std::construct_at(Slots() + size_, value);
+    ++size_;
+    return true;
+}
+
+template <class T, int32_t N>
+template <class... Args>
+constexpr T& InplaceVector<T, N>::EmplaceBack(Args&&... args) {
+    if (size_ == static_cast<size_t>(N)) {
+        throw InplaceVectorOverflow{};
+    }
+    T* slot = std::construct_at(Slots() + size_, std::forward<Args>(args)...);
+    ++size_;
+    return *slot;
+}
+
+template <class T, int32_t N>
+constexpr InplaceVector<T, N>& InplaceVector<T, N>::PopBack() {
+    std::destroy_at(Slots() + --size_);
+    return *this;
+}
+
+template <class T, int32_t N>
+constexpr InplaceVector<T, N>& InplaceVector<T, N>::Resize(const size_t& new_size) {
+    if (new_size > static_cast<size_t>(N)) {
+        throw InplaceVectorOverflow{};
+    }
+    while (size_ > new_size) {
+        PopBack();
+    }
+    for (; size_ < new_size; ++size_) {
+        std::construct_at(Slots() + size_);
+    }
+    return *this;
+}
+
+template <class T, int32_t N>
+constexpr InplaceVector<T, N>& InplaceVector<T, N>::Resize(const size_t& new_size, const T& value) {
+    if (new_size > static_cast<size_t>(N)) {
+        throw InplaceVectorOverflow{};
+    }
+    while (size_ > new_size) {
+        PopBack();
+    }
+    for (; size_ < new_size; ++size_) {
+        std::construct_at(Slots() + size_, value);
+    }
+    return *this;
+}
+
+template <class T, int32_t N>
+constexpr InplaceVector<T, N>& InplaceVector<T, N>::Swap(InplaceVector<T, N>& other) {
+    InplaceVector<T, N>& shorter = size_ < other.size_ ? *this : other;
+    InplaceVector<T, N>& longer = size_ < other.size_ ? other : *this;
+    size_t common = shorter.size_;
+    std::swap_ranges(shorter.Slots(), shorter.Slots() + common, longer.Slots());
+    for (; shorter.size_ < longer.size_; ++shorter.size_) {
+        std::construct_at(shorter.Slots() + shorter.size_, std::move(longer.Slots()[shorter.size_]));
+    }
+    while (longer.size_ > common) {
+        longer.PopBack();
+    }
+    return *this;
+}
+
+template <class T, int32_t N>
+constexpr T& InplaceVector<T, N>::operator[](const size_t& index) {
+    return Slots()[index];
+}
+
+template <class T, int32_t N>
+constexpr T InplaceVector<T, N>::operator[](const size_t& index) const {
+    return Slots()[index];
+}
+
+template <class T, int32_t N>
+constexpr T& InplaceVector<T, N>::At(const size_t& index) {
+    if (index >= size_) {
+        throw ArrayOutOfRange{};
+    }
+    return Slots()[index];
+}
+
+template <class T, int32_t N>
+constexpr T InplaceVector<T, N>::At(const size_t& index) const {
+    if (index >= size_) {
+        throw ArrayOutOfRange{};
+    }
+    return Slots()[index];
+}
+
+template <class T, int32_t N>
+constexpr T& InplaceVector<T, N>::Front() {
+    return Slots()[0];
+}
+
+template <class T, int32_t N>
+constexpr T InplaceVector<T, N>::Front() const {
+    return Slots()[0];
+}
+
+template <class T, int32_t N>
+constexpr T& InplaceVector<T, N>::Back() {
+    return Slots()[size_ - 1];
+}
+
+template <class T, int32_t N>
+constexpr T InplaceVector<T, N>::Back() const {
+    return Slots()[size_ - 1];
+}
+
+template <class T, int32_t N>
+constexpr bool InplaceVector<T, N>::Empty() const {
+    return size_ == 0;
+}
+
+template <class T, int32_t N>
+constexpr size_t InplaceVector<T, N>::Size() const {
+    return size_;
+}
+
+template <class T, int32_t N>
+constexpr size_t InplaceVector<T, N>::Capacity() const {
+    return N;
+}
+
+template <class T, int32_t N>
+constexpr T* InplaceVector<T, N>::Data() {
+    return Slots();
+}
+
+template <class T, int32_t N>
+constexpr const T* InplaceVector<T, N>::Data() const {
+    return Slots();
+}
+
+template <class T, int32_t N>
+constexpr typename InplaceVector<T, N>::Iterator InplaceVector<T, N>::begin() {  //  NOLINT
+    return Slots();
+}
+
+template <class T, int32_t N>
+constexpr typename InplaceVector<T, N>::Iterator InplaceVector<T, N>::end() {  //  NOLINT
+    return Slots() + size_;
+}
+
+template <class T, int32_t N>
+constexpr typename InplaceVector<T, N>::ConstIterator InplaceVector<T, N>::begin() const {  //  NOLINT
+    return Slots();
+}
+
+template <class T, int32_t N>
+constexpr typename InplaceVector<T, N>::ConstIterator InplaceVector<T, N>::end() const {  //  NOLINT
+    return Slots() + size_;
+}
+
+template <class T, int32_t N>
+constexpr typename InplaceVector<T, N>::ConstIterator InplaceVector<T, N>::cbegin() const {  //  NOLINT
+    return Slots();
+}
+
+template <class T, int32_t N>
+constexpr typename InplaceVector<T, N>::ConstIterator InplaceVector<T, N>::cend() const {  //  NOLINT
+    return Slots() + size_;
+}
+
+template <class T, int32_t N>
+constexpr std::weak_ordering InplaceVector<T, N>::operator<=>(const InplaceVector<T, N>& other) const {
+    return LexicographicCompare(Slots(), size_, other.Slots(), other.size_);
+}
+
+template <class T, int32_t N>
+constexpr bool InplaceVector<T, N>::operator==(const InplaceVector<T, N>& other) const {
+    return RangesEqual(Slots(), size_, other.Slots(), other.size_);
+}
+
+#endif  // ARRAY_INPLACE_VECTOR_H
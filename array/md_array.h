@@ -0,0 +1,429 @@
+#ifndef ARRAY_MD_ARRAY_H
+#define ARRAY_MD_ARRAY_H
+
+#include "array.h"
+#include <array>
+#include <cstddef>
+#include <type_traits>
+#include <utility>
+#if __has_include(<mdspan>)
+#include <mdspan>
+#endif
+
+struct RowMajor {};
+struct ColumnMajor {};
+
+template <class T, class Strides, int32_t... Dims>
+class MdView;
+
+namespace md_array_detail {
+
+template <class Layout, int32_t... Dims>
+constexpr std::array<int32_t, sizeof...(Dims)> ComputeStrides() {
+    std::array<int32_t, sizeof...(Dims)> extents{Dims...};
+    std::array<int32_t, sizeof...(Dims)> strides{};
+    int32_t stride = 1;
+    for (size_t i = 0; i < extents.size(); ++i) {
+        size_t r = std::is_same_v<Layout, RowMajor> ? extents.size() - 1 - i : i;
+        strides[r] = stride;
+        stride *= extents[r];
+    }
+    return strides;
+}
+
+template <class T, auto kExtents, auto kStrides, class = std::make_index_sequence<kExtents.size()>>
+struct ViewFromArrays;
+
+template <class T, auto kExtents, auto kStrides, size_t... I>
+struct ViewFromArrays<T, kExtents, kStrides, std::index_sequence<I...>> {
+    using Type = MdView<T, std::integer_sequence<int32_t, kStrides[I]...>, kExtents[I]...>;
+};
+
+template <size_t Dim, size_t R>
+constexpr std::array<int32_t, R - 1> Erase(const std::array<int32_t, R>& values) {
+    std::array<int32_t, R - 1> result{};
+    for (size_t i = 0, j = 0; i < R; ++i) {
+        if (i != Dim) {
+            result[j++] = values[i];
+        }
+    }
+    return result;
+}
+
+template <int32_t... Dims, class... Indices>
+constexpr bool InBounds(Indices... indices) {
+    return ((indices >= 0 && indices < Dims) && ...);
+}
+
+}  // namespace md_array_detail
+
+// Non-owning view with compile-time extents and strides: a single pointer, indexed with a fully unrolled dot product.
+template <class T, int32_t... S, int32_t... Dims>
+class MdView<T, std::integer_sequence<int32_t, S...>, Dims...> {
+    static_assert(sizeof...(S) == sizeof...(Dims), "RankMismatch");
+
+    T* data_;
+
+public:
+    static constexpr int32_t kRank = sizeof...(Dims);
+    static constexpr std::array<int32_t, sizeof...(Dims)> kExtents{Dims...};
+    static constexpr std::array<int32_t, sizeof...(Dims)> kStrides{S...};
+
+    constexpr explicit MdView(T*);
+    template <class... Indices>
+        requires(sizeof...(Indices) == sizeof...(Dims))
+    constexpr T& operator()(Indices...) const;
+    template <class... Indices>
+        requires(sizeof...(Indices) == sizeof...(Dims))
+    constexpr T& At(Indices...) const;
+    constexpr decltype(auto) operator[](const int32_t&) const;
+    constexpr T* Data() const;
+    constexpr int32_t Size() const;
+    constexpr int32_t Rank() const;
+    constexpr int32_t Extent(const int32_t&) const;
+    constexpr int32_t Stride(const int32_t&) const;
+    template <size_t Dim>
+    constexpr auto Slice(const int32_t&) const;
+    template <int32_t... Sizes, class... Offsets>
+        requires(sizeof...(Sizes) == sizeof...(Dims) && sizeof...(Offsets) == sizeof...(Dims))
+    constexpr auto Tile(Offsets...) const;
+#ifdef __cpp_lib_mdspan
+    constexpr auto ToMdspan() const;
+#endif
+};
+
+template <class T, int32_t... S, int32_t... Dims>
+constexpr MdView<T, std::integer_sequence<int32_t, S...>, Dims...>::MdView(T* data) : data_(data) {
+}
+
+template <class T, int32_t... S, int32_t... Dims>
+template <class... Indices>
+    requires(sizeof...(Indices) == sizeof...(Dims))
+constexpr T& MdView<T, std::integer_sequence<int32_t, S...>, Dims...>::operator()(Indices... indices) const {
+    return data_[((static_cast<int32_t>(indices) * S) + ... + 0)];
+}
+
+template <class T, int32_t... S, int32_t... Dims>
+template <class... Indices>
+    requires(sizeof...(Indices) == sizeof...(Dims))
+constexpr T& MdView<T, std::integer_sequence<int32_t, S...>, Dims...>::At(Indices... indices) const {
+    if (!md_array_detail::InBounds<Dims...>(static_cast<int32_t>(indices)...)) {
+        throw ArrayOutOfRange{};
+    }
+    return (*this)(indices...);
+}
+
+// Indexing by the first coordinate, so that view[i][j] works like a nested C array.
+template <class T, int32_t... S, int32_t... Dims>
+constexpr decltype(auto) MdView<T, std::integer_sequence<int32_t, S...>, Dims...>::operator[](const int32_t& i) const {
+    if constexpr (kRank == 1) {
+        return (*this)(i);
+    } else {
+        return Slice<0>(i);
+    }
+}
+
+template <class T, int32_t... S, int32_t... Dims>
+constexpr T* MdView<T, std::integer_sequence<int32_t, S...>, Dims...>::Data() const {
+    return data_;
+}
+
+template <class T, int32_t... S, int32_t... Dims>
+constexpr int32_t MdView<T, std::integer_sequence<int32_t, S...>, Dims...>::Size() const {
+    return (Dims * ...);
+}
+
+template <class T, int32_t... S, int32_t... Dims>
+constexpr int32_t MdView<T, std::integer_sequence<int32_t, S...>, Dims...>::Rank() const {
+    return kRank;
+}
+
+template <class T, int32_t... S, int32_t... Dims>
+constexpr int32_t MdView<T, std::integer_sequence<int32_t, S...>, Dims...>::Extent(const int32_t& r) const {
+    return kExtents[r];
+}
+
+template <class T, int32_t... S, int32_t... Dims>
+constexpr int32_t MdView<T, std::integer_sequence<int32_t, S...>, Dims...>::Stride(const int32_t& r) const {
+    return kStrides[r];
+}
+
+// Fixes coordinate Dim to index; the result has rank one less.
+template <class T, int32_t... S, int32_t... Dims>
+template <size_t Dim>
+constexpr auto MdView<T, std::integer_sequence<int32_t, S...>, Dims...>::Slice(const int32_t& index) const {
+    static_assert(Dim < sizeof...(Dims) && sizeof...(Dims) > 1, "BadSliceDimension");
+    using View = typename md_array_detail::ViewFromArrays<T, md_array_detail::Erase<Dim>(kExtents),
+                                                          md_array_detail::Erase<Dim>(kStrides)>::Type;
+    return View(data_ + index * kStrides[Dim]);
+}
+
+// Sizes[0] x Sizes[1] x ... block starting at offsets, keeping the strides of this view.
+template <class T, int32_t... S, int32_t... Dims>
+template <int32_t... Sizes, class... Offsets>
+    requires(sizeof...(Sizes) == sizeof...(Dims) && sizeof...(Offsets) == sizeof...(Dims))
+constexpr auto MdView<T, std::integer_sequence<int32_t, S...>, Dims...>::Tile(Offsets... offsets) const {
+    static_assert(((Sizes <= Dims) && ...), "TileTooLarge");
+    return MdView<T, std::integer_sequence<int32_t, S...>, Sizes...>(&(*this)(offsets...));
+}
+
+#ifdef __cpp_lib_mdspan
+template <class T, int32_t... S, int32_t... Dims>
+constexpr auto MdView<T, std::integer_sequence<int32_t, S...>, Dims...>::ToMdspan() const {
+    using Extents = std::extents<int32_t, Dims...>;
+    return std::mdspan(data_, std::layout_stride::mapping<Extents>(Extents{}, kStrides));
+}
+#endif
+
+// Dense multidimensional array in one contiguous buffer, with the layout fixed at compile time.
+template <class T, class Layout, int32_t... Dims>
+struct MdArray {
+    static_assert(sizeof...(Dims) > 0, "NoDimensions");
+    static_assert(std::is_same_v<Layout, RowMajor> || std::is_same_v<Layout, ColumnMajor>, "UnknownLayout");
+
+    static constexpr std::array<int32_t, sizeof...(Dims)> kExtents{Dims...};
+    static constexpr std::array<int32_t, sizeof...(Dims)> kStrides = md_array_detail::ComputeStrides<Layout, Dims...>();
+    using View = typename md_array_detail::ViewFromArrays<T, kExtents, kStrides>::Type;
+    using ConstView = typename md_array_detail::ViewFromArrays<const T, kExtents, kStrides>::Type;
+    using Iterator = T*;
+    using ConstIterator = const T*;
+    using value_type = T;                  //  NOLINT
+    using iterator = Iterator;             //  NOLINT
+    using const_iterator = ConstIterator;  //  NOLINT
+
+    T buffer_[(Dims * ...)];
+
+    template <class... Indices>
+    constexpr const T& operator()(Indices...) const;
+    template <class... Indices>
+    constexpr T& operator()(Indices...);
+    template <class... Indices>
+    constexpr const T& At(Indices...) const;
+    template <class... Indices>
+    constexpr T& At(Indices...);
+    constexpr decltype(auto) operator[](const int32_t&) const;
+    constexpr decltype(auto) operator[](const int32_t&);
+    constexpr ConstView GetView() const;
+    constexpr View GetView();
+    template <size_t Dim>
+    constexpr auto Slice(const int32_t&) const;
+    template <size_t Dim>
+    constexpr auto Slice(const int32_t&);
+    template <int32_t... Sizes, class... Offsets>
+    constexpr auto Tile(Offsets...) const;
+    template <int32_t... Sizes, class... Offsets>
+    constexpr auto Tile(Offsets...);
+    constexpr T* Data();
+    constexpr T const* Data() const;
+    constexpr int32_t Size() const;
+    constexpr int32_t Rank() const;
+    constexpr int32_t Extent(const int32_t&) const;
+    constexpr int32_t Stride(const int32_t&) const;
+    constexpr bool Empty() const;
+    constexpr Iterator begin();              //  NOLINT
+    constexpr Iterator end();                //  NOLINT
+    constexpr ConstIterator begin() const;   //  NOLINT
+    constexpr ConstIterator end() const;     //  NOLINT
+    constexpr ConstIterator cbegin() const;  //  NOLINT
+    constexpr ConstIterator cend() const;    //  NOLINT
+    constexpr void Fill(const T&);
+    constexpr void Swap(MdArray<T, Layout, Dims...>&);
+    constexpr void swap(MdArray<T, Layout, Dims...>&);  //  NOLINT
+    constexpr std::weak_ordering operator<=>(const MdArray<T, Layout, Dims...>&) const;
+    constexpr bool operator==(const MdArray<T, Layout, Dims...>&) const;
+#ifdef __cpp_lib_mdspan
+    constexpr auto ToMdspan();
+    constexpr auto ToMdspan() const;
+#endif
+};
+
+// Array<T, N, M, ...> is a row-major MdArray, so a[i][j] addresses the same element as in T[N][M].
+template <class T, int32_t N, int32_t... Dims>
+struct Array : MdArray<T, RowMajor, N, Dims...> {};
+
+template <class T, class Layout, int32_t... Dims>
+template <class... Indices>
+constexpr const T& MdArray<T, Layout, Dims...>::operator()(Indices... indices) const {
+    return GetView()(indices...);
+}
+
+template <class T, class Layout, int32_t... Dims>
+template <class... Indices>
+constexpr T& MdArray<T, Layout, Dims...>::operator()(Indices... indices) {
+    return GetView()(indices...);
+}
+
+template <class T, class Layout, int32_t... Dims>
+template <class... Indices>
+constexpr const T& MdArray<T, Layout, Dims...>::At(Indices... indices) const {
+    return GetView().At(indices...);
+}
+
+template <class T, class Layout, int32_t... Dims>
+template <class... Indices>
+constexpr T& MdArray<T, Layout, Dims...>::At(Indices... indices) {
+    return GetView().At(indices...);
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr decltype(auto) MdArray<T, Layout, Dims...>::operator[](const int32_t& i) const {
+    return GetView()[i];
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr decltype(auto) MdArray<T, Layout, Dims...>::operator[](const int32_t& i) {
+    return GetView()[i];
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr typename MdArray<T, Layout, Dims...>::ConstView MdArray<T, Layout, Dims...>::GetView() const {
+    return ConstView(buffer_);
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr typename MdArray<T, Layout, Dims...>::View MdArray<T, Layout, Dims...>::GetView() {
+    return View(buffer_);
+}
+
+template <class T, class Layout, int32_t... Dims>
+template <size_t Dim>
+constexpr auto MdArray<T, Layout, Dims...>::Slice(const int32_t& index) const {
+    return GetView().template Slice<Dim>(index);
+}
+
+template <class T, class Layout, int32_t... Dims>
+template <size_t Dim>
+constexpr auto MdArray<T, Layout, Dims...>::Slice(const int32_t& index) {
+    return GetView().template Slice<Dim>(index);
+}
+
+template <class T, class Layout, int32_t... Dims>
+template <int32_t... Sizes, class... Offsets>
+constexpr auto MdArray<T, Layout, Dims...>::Tile(Offsets... offsets) const {
+    return GetView().template Tile<Sizes...>(offsets...);
+}
+
+template <class T, class Layout, int32_t... Dims>
+template <int32_t... Sizes, class... Offsets>
+constexpr auto MdArray<T, Layout, Dims...>::Tile(Offsets... offsets) {
+    return GetView().template Tile<Sizes...>(offsets...);
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr T* MdArray<T, Layout, Dims...>::Data() {
+    return buffer_;
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr T const* MdArray<T, Layout, Dims...>::Data() const {
+    return buffer_;
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr int32_t MdArray<T, Layout, Dims...>::Size() const {
+    return (Dims * ...);
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr int32_t MdArray<T, Layout, Dims...>::Rank() const {
+    return sizeof...(Dims);
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr int32_t MdArray<T, Layout, Dims...>::Extent(const int32_t& r) const {
+    return kExtents[r];
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr int32_t MdArray<T, Layout, Dims...>::Stride(const int32_t& r) const {
+    return kStrides[r];
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr bool MdArray<T, Layout, Dims...>::Empty() const {
+    return Size() == 0;
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr typename MdArray<T, Layout, Dims...>::Iterator MdArray<T, Layout, Dims...>::begin() {  //  NOLINT
+    return buffer_;
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr typename MdArray<T, Layout, Dims...>::Iterator MdArray<T, Layout, Dims...>::end() {  //  NOLINT
+    return buffer_ + Size();
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr typename MdArray<T, Layout, Dims...>::ConstIterator MdArray<T, Layout, Dims...>::begin() const {  //  NOLINT
+    return buffer_;
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr typename MdArray<T, Layout, Dims...>::ConstIterator MdArray<T, Layout, Dims...>::end() const {  //  NOLINT
+    return buffer_ + Size();
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr typename MdArray<T, Layout, Dims...>::ConstIterator MdArray<T, Layout, Dims...>::cbegin() const {  //  NOLINT
+    return buffer_;
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr typename MdArray<T, Layout, Dims...>::ConstIterator MdArray<T, Layout, Dims...>::cend() const {  //  NOLINT
+    return buffer_ + Size();
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr void MdArray<T, Layout, Dims...>::Fill(const T& value) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (!std::is_constant_evaluated()) {
+            FillTrivial(buffer_, Size(), value);
+            return;
+        }
+    }
+    std::fill(begin(), end(), value);
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr void MdArray<T, Layout, Dims...>::Swap(MdArray<T, Layout, Dims...>& other) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        if (!std::is_constant_evaluated()) {
+            SwapTrivial(buffer_, other.buffer_, Size());
+            return;
+        }
+    }
+    std::swap_ranges(begin(), end(), other.begin());
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr void MdArray<T, Layout, Dims...>::swap(MdArray<T, Layout, Dims...>& other) {  //  NOLINT
+    Swap(other);
+}
+
+// Lexicographic over the storage order.
+template <class T, class Layout, int32_t... Dims>
+constexpr std::weak_ordering MdArray<T, Layout, Dims...>::operator<=>(const MdArray<T, Layout, Dims...>& other) const {
+    return LexicographicCompare(buffer_, Size(), other.buffer_, Size());
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr bool MdArray<T, Layout, Dims...>::operator==(const MdArray<T, Layout, Dims...>& other) const {
+    return RangesEqual(buffer_, Size(), other.buffer_, Size());
+}
+
+#ifdef __cpp_lib_mdspan
+template <class T, class Layout, int32_t... Dims>
+constexpr auto MdArray<T, Layout, Dims...>::ToMdspan() {
+    using StdLayout = std::conditional_t<std::is_same_v<Layout, RowMajor>, std::layout_right, std::layout_left>;
+    return std::mdspan<T, std::extents<int32_t, Dims...>, StdLayout>(buffer_);
+}
+
+template <class T, class Layout, int32_t... Dims>
+constexpr auto MdArray<T, Layout, Dims...>::ToMdspan() const {
+    using StdLayout = std::conditional_t<std::is_same_v<Layout, RowMajor>, std::layout_right, std::layout_left>;
+    return std::mdspan<const T, std::extents<int32_t, Dims...>, StdLayout>(buffer_);
+}
+#endif
+
+#endif  // ARRAY_MD_ARRAY_H
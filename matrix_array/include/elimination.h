@@ -0,0 +1,330 @@
+#ifndef MATRIX_ARRAY_ELIMINATION_H
+#define MATRIX_ARRAY_ELIMINATION_H
+
+#include <util/constants.h>
+#include <matrix_parallel.h>
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <limits>
+#include <type_traits>
+#include <utility>
+
+// Kernels below work on a row-major n x n matrix a and overwrite it. The row updates of one elimination step are
+// independent and run in parallel for large matrices (ForEachRowBlock).
+
+template <class T>
+void SwapRows(T* a, const size_t& n, const size_t& f, const size_t& s) {
+    std::swap_ranges(a + f * n, a + (f + 1) * n, a + s * n);
+}
+
+// Row at or below k to pivot on in column k: the largest in magnitude for floating point types, the first non-zero
+// one otherwise. Returns n when the column has no non-zero entry there.
+template <class T>
+size_t FindPivot(const T* a, const size_t& n, const size_t& k) {
+    size_t pivot = n;
+    for (size_t i = k; i < n; ++i) {
+        if (a[i * n + k] == kZero<T>) {
+            continue;
+        }
+        if constexpr (std::is_floating_point_v<T>) {
+            if (pivot == n || std::abs(a[i * n + k]) > std::abs(a[pivot * n + k])) {
+                pivot = i;
+            }
+        } else {
+            return i;
+        }
+    }
+    return pivot;
+}
+
+// PA = LU in place: the strictly lower triangle receives L (its unit diagonal is implied), the upper triangle U, and
+// row i of PA is row permutation[i] of A. odd is set when P is an odd permutation. Returns false for a singular a.
+template <class T>
+bool LuFactorize(T* a, size_t* permutation, const size_t& n, bool& odd) {
+    odd = false;
+    for (size_t i = 0; i < n; ++i) {
+        permutation[i] = i;
+    }
+    for (size_t k = 0; k < n; ++k) {
+        size_t pivot = FindPivot(a, n, k);
+        if (pivot == n) {
+            return false;
+        }
+        if (pivot != k) {
+            SwapRows(a, n, pivot, k);
+            std::swap(permutation[pivot], permutation[k]);
+            odd = !odd;
+        }
+        ForEachRowBlock(k + 1, n, n - k, 1, [&](const size_t& first, const size_t& last) {
+            for (size_t i = first; i < last; ++i) {
+                a[i * n + k] /= a[k * n + k];
+                T factor = a[i * n + k];
+                for (size_t j = k + 1; j < n; ++j) {
+                    a[i * n + j] -= factor * a[k * n + j];
+                }
+            }
+        });
+    }
+    return true;
+}
+
+// x[n x k] = A^-1 b[n x k] for A factorized by LuFactorize. Substitution runs over whole rows of x, so all right-hand
+// sides advance together along contiguous memory.
+template <class T>
+void LuSolve(const T* lu, const size_t* permutation, const size_t& n, const T* b, T* x, const size_t& k) {
+    for (size_t i = 0; i < n; ++i) {
+        std::copy(b + permutation[i] * k, b + (permutation[i] + 1) * k, x + i * k);
+        for (size_t p = 0; p < i; ++p) {
+            T factor = lu[i * n + p];
+            for (size_t j = 0; j < k; ++j) {
+                x[i * k + j] -= factor * x[p * k + j];
+            }
+        }
+    }
+    for (size_t i = n; i-- > 0;) {
+        for (size_t p = i + 1; p < n; ++p) {
+            T factor = lu[i * n + p];
+            for (size_t j = 0; j < k; ++j) {
+                x[i * k + j] -= factor * x[p * k + j];
+            }
+        }
+        for (size_t j = 0; j < k; ++j) {
+            x[i * k + j] /= lu[i * n + i];
+        }
+    }
+}
+
+template <class T>
+T LuDeterminant(T* a, const size_t& n) {
+    T determinant = kOne<T>;
+    for (size_t k = 0; k < n; ++k) {
+        size_t pivot = FindPivot(a, n, k);
+        if (pivot == n) {
+            return kZero<T>;
+        }
+        if (pivot != k) {
+            SwapRows(a, n, pivot, k);
+            determinant = kZero<T> - determinant;
+        }
+        determinant *= a[k * n + k];
+        ForEachRowBlock(k + 1, n, n - k, 1, [&](const size_t& first, const size_t& last) {
+            for (size_t i = first; i < last; ++i) {
+                T factor = a[i * n + k] / a[k * n + k];
+                for (size_t j = k + 1; j < n; ++j) {
+                    a[i * n + j] -= factor * a[k * n + j];
+                }
+            }
+        });
+    }
+    return determinant;
+}
+
+// In-place Gauss-Jordan elimination with partial pivoting. Column k of the identity is never stored: once row k is
+// reduced, column k is reused for the corresponding column of the inverse, and the row swaps are undone as column
+// swaps at the end. Returns false for a singular a, leaving it partially reduced.
+template <class T>
+bool InvertInPlace(T* a, size_t* swaps, const size_t& n) {
+    for (size_t k = 0; k < n; ++k) {
+        size_t pivot = FindPivot(a, n, k);
+        if (pivot == n) {
+            return false;
+        }
+        swaps[k] = pivot;
+        if (pivot != k) {
+            SwapRows(a, n, pivot, k);
+        }
+        T inverse = kOne<T> / a[k * n + k];
+        a[k * n + k] = kOne<T>;
+        for (size_t j = 0; j < n; ++j) {
+            a[k * n + j] *= inverse;
+        }
+        ForEachRowBlock(0, n, n, 1, [&](const size_t& first, const size_t& last) {
+            for (size_t i = first; i < last; ++i) {
+                if (i == k || a[i * n + k] == kZero<T>) {
+                    continue;
+                }
+                T factor = a[i * n + k];
+                a[i * n + k] = kZero<T>;
+                for (size_t j = 0; j < n; ++j) {
+                    a[i * n + j] -= factor * a[k * n + j];
+                }
+            }
+        });
+    }
+    for (size_t k = n; k-- > 0;) {
+        if (swaps[k] != k) {
+            for (size_t i = 0; i < n; ++i) {
+                std::swap(a[i * n + k], a[i * n + swaps[k]]);
+            }
+        }
+    }
+    return true;
+}
+
+// A = L L^T for a symmetric positive definite a; only the lower triangle of a is read, and it is overwritten by L.
+// Returns false when a is not positive definite.
+template <class T>
+bool CholeskyFactorize(T* a, const size_t& n) {
+    for (size_t j = 0; j < n; ++j) {
+        T diagonal = a[j * n + j];
+        for (size_t p = 0; p < j; ++p) {
+            diagonal -= a[j * n + p] * a[j * n + p];
+        }
+        if (!(diagonal > kZero<T>)) {
+            return false;
+        }
+        a[j * n + j] = std::sqrt(diagonal);
+        for (size_t i = j + 1; i < n; ++i) {
+            T value = a[i * n + j];
+            for (size_t p = 0; p < j; ++p) {
+                value -= a[i * n + p] * a[j * n + p];
+            }
+            a[i * n + j] = value / a[j * n + j];
+        }
+    }
+    return true;
+}
+
+// x[n x k] = A^-1 b[n x k] for A = L L^T; both triangular solves update whole rows of x.
+template <class T>
+void CholeskySolve(const T* l, const size_t& n, const T* b, T* x, const size_t& k) {
+    for (size_t i = 0; i < n; ++i) {
+        std::copy(b + i * k, b + (i + 1) * k, x + i * k);
+        for (size_t p = 0; p < i; ++p) {
+            T factor = l[i * n + p];
+            for (size_t j = 0; j < k; ++j) {
+                x[i * k + j] -= factor * x[p * k + j];
+            }
+        }
+        for (size_t j = 0; j < k; ++j) {
+            x[i * k + j] /= l[i * n + i];
+        }
+    }
+    for (size_t i = n; i-- > 0;) {
+        for (size_t j = 0; j < k; ++j) {
+            x[i * k + j] /= l[i * n + i];
+        }
+        for (size_t p = 0; p < i; ++p) {
+            T factor = l[i * n + p];
+            for (size_t j = 0; j < k; ++j) {
+                x[p * k + j] -= factor * x[i * k + j];
+            }
+        }
+    }
+}
+
+// Householder QR of a row-major n x m matrix, n >= m. Column k of a at and below the diagonal receives the reflector
+// v_k of H_k = I - tau_k v_k v_k^T, diagonal[k] receives R[k][k], and the strict upper triangle holds the rest of R.
+// Returns false when a has linearly dependent columns up to rounding: the part of a column orthogonal to the previous
+// ones is below n epsilons relative to the largest R[k][k] so far.
+template <class T>
+bool HouseholderQr(T* a, T* tau, T* diagonal, const size_t& n, const size_t& m) {
+    T largest = kZero<T>;
+    for (size_t k = 0; k < m; ++k) {
+        T norm = kZero<T>;
+        for (size_t i = k; i < n; ++i) {
+            norm += a[i * m + k] * a[i * m + k];
+        }
+        norm = std::sqrt(norm);
+        if (norm == kZero<T> || norm <= std::numeric_limits<T>::epsilon() * static_cast<T>(n) * largest) {
+            return false;
+        }
+        largest = std::max(largest, norm);
+        T alpha = a[k * m + k] > kZero<T> ? -norm : norm;
+        a[k * m + k] -= alpha;
+        T length = kZero<T>;
+        for (size_t i = k; i < n; ++i) {
+            length += a[i * m + k] * a[i * m + k];
+        }
+        tau[k] = 2 / length;
+        diagonal[k] = alpha;
+        for (size_t j = k + 1; j < m; ++j) {
+            T dot = kZero<T>;
+            for (size_t i = k; i < n; ++i) {
+                dot += a[i * m + k] * a[i * m + j];
+            }
+            dot *= tau[k];
+            for (size_t i = k; i < n; ++i) {
+                a[i * m + j] -= dot * a[i * m + k];
+            }
+        }
+    }
+    return true;
+}
+
+// Least squares solution x[m x k] of A x = b for A factorized by HouseholderQr. b[n x k] is overwritten by Q^T b and
+// dots holds k scratch values; reflectors are applied to whole rows of b at once.
+template <class T>
+void QrSolve(const T* qr, const T* tau, const T* diagonal, const size_t& n, const size_t& m, T* b, T* x,
+             const size_t& k, T* dots) {
+    for (size_t p = 0; p < m; ++p) {
+        std::fill(dots, dots + k, kZero<T>);
+        for (size_t i = p; i < n; ++i) {
+            for (size_t j = 0; j < k; ++j) {
+                dots[j] += qr[i * m + p] * b[i * k + j];
+            }
+        }
+        for (size_t i = p; i < n; ++i) {
+            T factor = tau[p] * qr[i * m + p];
+            for (size_t j = 0; j < k; ++j) {
+                b[i * k + j] -= factor * dots[j];
+            }
+        }
+    }
+    for (size_t i = m; i-- > 0;) {
+        std::copy(b + i * k, b + (i + 1) * k, x + i * k);
+        for (size_t p = i + 1; p < m; ++p) {
+            T factor = qr[i * m + p];
+            for (size_t j = 0; j < k; ++j) {
+                x[i * k + j] -= factor * x[p * k + j];
+            }
+        }
+        for (size_t j = 0; j < k; ++j) {
+            x[i * k + j] /= diagonal[i];
+        }
+    }
+}
+
+// Fraction-free (Bareiss) elimination: every division is exact, so integers and rationals never leave their domain
+// and intermediate values stay bounded by minors of a. The last pivot is the determinant.
+template <class T>
+T BareissDeterminant(T* a, const size_t& n) {
+    if (n == 0) {
+        return kOne<T>;
+    }
+    T previous = kOne<T>;
+    bool negate = false;
+    for (size_t k = 0; k + 1 < n; ++k) {
+        if (a[k * n + k] == kZero<T>) {
+            size_t pivot = k + 1;
+            while (pivot < n && a[pivot * n + k] == kZero<T>) {
+                ++pivot;
+            }
+            if (pivot == n) {
+                return kZero<T>;
+            }
+            SwapRows(a, n, pivot, k);
+            negate = !negate;
+        }
+        for (size_t i = k + 1; i < n; ++i) {
+            for (size_t j = k + 1; j < n; ++j) {
+                a[i * n + j] = (a[i * n + j] * a[k * n + k] - a[i * n + k] * a[k * n + j]) / previous;
+            }
+        }
+        previous = a[k * n + k];
+    }
+    T determinant = a[n * n - 1];
+    return negate ? kZero<T> - determinant : determinant;
+}
+
+template <class T>
+T DeterminantInPlace(T* a, const size_t& n) {
+    if constexpr (std::is_floating_point_v<T>) {
+        return LuDeterminant(a, n);
+    } else {
+        return BareissDeterminant(a, n);
+    }
+}
+
+#endif  // MATRIX_ARRAY_ELIMINATION_H
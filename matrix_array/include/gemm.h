@@ -0,0 +1,123 @@
+#ifndef MATRIX_ARRAY_GEMM_H
+#define MATRIX_ARRAY_GEMM_H
+
+#include <util/constants.h>
+#include <matrix_parallel.h>
+#include <simd_kernels.h>
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <type_traits>
+
+const size_t kL1CacheSize = 32 * 1024;
+const size_t kL2CacheSize = 512 * 1024;
+const size_t kGemmRowBlock = 4;
+const size_t kGemmParallelRows = 8 * kGemmRowBlock;
+
+// Block sizes of the product C[n x k] = A[n x m] * B[m x k]: the kGemmRowBlock rows of C being updated keep a
+// columns_-wide strip in L1, the depth_ x columns_ panel of B stays in L2 while rows_ rows of A stream past it.
+struct GemmTiles {
+    size_t rows_;
+    size_t depth_;
+    size_t columns_;
+};
+
+template <class T>
+constexpr GemmTiles ComputeGemmTiles(const size_t& n, const size_t& m, const size_t& k) {
+    auto fit = [](const size_t& extent, const size_t& tile) {
+        return std::max<size_t>(1, std::min(extent, std::max<size_t>(8, tile / 8 * 8)));
+    };
+    size_t columns = fit(k, kL1CacheSize / (2 * kGemmRowBlock * sizeof(T)));
+    size_t depth = fit(m, kL2CacheSize / (2 * columns * sizeof(T)));
+    size_t rows = fit(n, kL2CacheSize / (2 * depth * sizeof(T)));
+    return {rows, depth, columns};
+}
+
+// c[rows x columns] += a[rows x depth] * b[depth x columns]. Four rows of c are updated per pass over b, so every
+// loaded element of b is used four times; the innermost loop runs along contiguous rows of b and c. The columns
+// covered by the vector FMA kernel are skipped.
+template <class T>
+void GemmMicroKernel(const T* a, const size_t& lda, const T* b, const size_t& ldb, T* c, const size_t& ldc,
+                     const size_t& rows, const size_t& depth, const size_t& columns) {
+    size_t done = SimdGemmBlock<kGemmRowBlock>(a, lda, b, ldb, c, ldc, rows, depth, columns);
+    size_t i = 0;
+    for (; i + kGemmRowBlock <= rows; i += kGemmRowBlock) {
+        T* c0 = c + i * ldc;
+        T* c1 = c0 + ldc;
+        T* c2 = c1 + ldc;
+        T* c3 = c2 + ldc;
+        const T* a0 = a + i * lda;
+        for (size_t p = 0; p < depth; ++p) {
+            const T* bp = b + p * ldb;
+            T x0 = a0[p];
+            T x1 = a0[lda + p];
+            T x2 = a0[2 * lda + p];
+            T x3 = a0[3 * lda + p];
+#pragma GCC ivdep
+            for (size_t j = done; j < columns; ++j) {
+                c0[j] += x0 * bp[j];
+                c1[j] += x1 * bp[j];
+                c2[j] += x2 * bp[j];
+                c3[j] += x3 * bp[j];
+            }
+        }
+    }
+    for (; i < rows; ++i) {
+        T* ci = c + i * ldc;
+        for (size_t p = 0; p < depth; ++p) {
+            const T* bp = b + p * ldb;
+            T x = a[i * lda + p];
+#pragma GCC ivdep
+            for (size_t j = 0; j < columns; ++j) {
+                ci[j] += x * bp[j];
+            }
+        }
+    }
+}
+
+// c += a * b for row-major operands with leading dimensions lda, ldb, ldc. Panels of b are copied into a contiguous
+// buffer when b is larger than one tile and T is trivially copyable.
+template <class T>
+void GemmAccumulate(const T* a, const size_t& lda, const T* b, const size_t& ldb, T* c, const size_t& ldc,
+                    const size_t& n, const size_t& m, const size_t& k, const GemmTiles& tiles) {
+    bool pack = std::is_trivially_copyable_v<T> && (tiles.depth_ < m || tiles.columns_ < k);
+    std::unique_ptr<T[]> panel;
+    if (pack) {
+        panel = std::make_unique_for_overwrite<T[]>(tiles.depth_ * tiles.columns_);
+    }
+    for (size_t jc = 0; jc < k; jc += tiles.columns_) {
+        size_t columns = std::min(tiles.columns_, k - jc);
+        for (size_t pc = 0; pc < m; pc += tiles.depth_) {
+            size_t depth = std::min(tiles.depth_, m - pc);
+            const T* block = b + pc * ldb + jc;
+            size_t ld = ldb;
+            if (pack) {
+                for (size_t p = 0; p < depth; ++p) {
+                    std::copy(block + p * ldb, block + p * ldb + columns, panel.get() + p * columns);
+                }
+                block = panel.get();
+                ld = columns;
+            }
+            for (size_t ic = 0; ic < n; ic += tiles.rows_) {
+                GemmMicroKernel(a + ic * lda + pc, lda, block, ld, c + ic * ldc + jc, ldc,
+                                std::min(tiles.rows_, n - ic), depth, columns);
+            }
+        }
+    }
+}
+
+// c = a * b; c must not overlap a or b. Large products are split into panels of kGemmParallelRows-multiple rows of c
+// computed in parallel; panels start at multiples of kGemmRowBlock, so every element is accumulated exactly as on
+// one thread.
+template <class T>
+void Gemm(const T* a, const size_t& lda, const T* b, const size_t& ldb, T* c, const size_t& ldc, const size_t& n,
+          const size_t& m, const size_t& k, const GemmTiles& tiles) {
+    ForEachRowBlock(0, n, m * k, kGemmParallelRows, [&](const size_t& first, const size_t& last) {
+        for (size_t i = first; i < last; ++i) {
+            std::fill(c + i * ldc, c + i * ldc + k, kZero<T>);
+        }
+        GemmAccumulate(a + first * lda, lda, b, ldb, c + first * ldc, ldc, last - first, m, k, tiles);
+    });
+}
+
+#endif  // MATRIX_ARRAY_GEMM_H
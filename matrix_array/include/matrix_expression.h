@@ -0,0 +1,315 @@
+#ifndef MATRIX_ARRAY_MATRIX_EXPRESSION_H
+#define MATRIX_ARRAY_MATRIX_EXPRESSION_H
+
+#include <matrix_parallel.h>
+#include <simd_kernels.h>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+
+template <class T, size_t N, size_t M>
+struct MatrixArray;
+
+// Lazy element-wise expressions over MatrixArray. A node only stores its operands (matrices by reference, nested
+// nodes by value) and computes an element on demand, so a whole chain like a + b - 2 * c is evaluated in one pass
+// straight into the destination. Nodes refer to their matrices: an expression must not outlive them, so do not keep
+// one in an auto variable past the end of the statement that uses the matrices.
+template <class X>
+concept MatrixExpressionNode = requires { typename X::MatrixExpressionTag; };
+
+namespace matrix_expression_detail {
+
+template <class X>
+struct Traits;
+
+template <class T, size_t N, size_t M>
+struct Traits<MatrixArray<T, N, M>> {
+    using Value = T;
+    static constexpr size_t kRows = N;
+    static constexpr size_t kColumns = M;
+    static constexpr bool kLeaf = true;
+};
+
+template <class X>
+requires MatrixExpressionNode<X>
+struct Traits<X> {
+    using Value = typename X::Value;
+    static constexpr size_t kRows = X::kRows;
+    static constexpr size_t kColumns = X::kColumns;
+    static constexpr bool kLeaf = false;
+};
+
+template <class X>
+using Stored = std::conditional_t<Traits<X>::kLeaf, const X&, X>;
+
+template <class T, size_t N, size_t M>
+const T& Element(const MatrixArray<T, N, M>& m, const size_t& i, const size_t& j) {
+    return m.buffer_[i][j];
+}
+
+template <MatrixExpressionNode X>
+auto Element(const X& x, const size_t& i, const size_t& j) {
+    return x(i, j);
+}
+
+template <class T, size_t N, size_t M>
+const T* Data(const MatrixArray<T, N, M>& m) {
+    return &m.buffer_[0][0];
+}
+
+// Whether x reads the matrix at address p at all, and whether it reads it at other positions than the one being
+// written, which makes evaluation straight into that matrix unsafe.
+template <class T, size_t N, size_t M>
+bool Refers(const MatrixArray<T, N, M>& m, const void* p) {
+    return static_cast<const void*>(&m) == p;
+}
+
+template <MatrixExpressionNode X>
+bool Refers(const X& x, const void* p) {
+    return x.Refers(p);
+}
+
+template <class T, size_t N, size_t M>
+bool MayAlias(const MatrixArray<T, N, M>&, const void*) {
+    return false;
+}
+
+template <MatrixExpressionNode X>
+bool MayAlias(const X& x, const void* p) {
+    return x.MayAlias(p);
+}
+
+}  // namespace matrix_expression_detail
+
+template <class X>
+concept MatrixOperand = requires { matrix_expression_detail::Traits<X>::kRows; };
+
+template <class L, class R>
+concept SameShapeOperands =
+    MatrixOperand<L> && MatrixOperand<R> &&
+    std::same_as<typename matrix_expression_detail::Traits<L>::Value,
+                 typename matrix_expression_detail::Traits<R>::Value> &&
+    matrix_expression_detail::Traits<L>::kRows == matrix_expression_detail::Traits<R>::kRows &&
+    matrix_expression_detail::Traits<L>::kColumns == matrix_expression_detail::Traits<R>::kColumns;
+
+// Shared part of all nodes: evaluation into a fresh matrix or into raw row-major storage by a fused loop.
+template <class Derived>
+struct MatrixExpression {
+    using MatrixExpressionTag = void;
+
+    template <class T, size_t N, size_t M>
+    operator MatrixArray<T, N, M>() const;  //  NOLINT
+    auto Evaluate() const;
+    template <class T>
+    void EvaluateFused(T*) const;
+};
+
+template <class Derived>
+template <class T, size_t N, size_t M>
+MatrixExpression<Derived>::operator MatrixArray<T, N, M>() const {
+    static_assert(N == Derived::kRows && M == Derived::kColumns, "MatrixSizeMismatch");
+    MatrixArray<T, N, M> m;
+    static_cast<const Derived&>(*this).EvaluateInto(&m.buffer_[0][0]);
+    return m;
+}
+
+template <class Derived>
+auto MatrixExpression<Derived>::Evaluate() const {
+    return static_cast<MatrixArray<typename Derived::Value, Derived::kRows, Derived::kColumns>>(*this);
+}
+
+template <class Derived>
+template <class T>
+void MatrixExpression<Derived>::EvaluateFused(T* out) const {
+    const auto& self = static_cast<const Derived&>(*this);
+    for (size_t i = 0; i < Derived::kRows; ++i) {
+        for (size_t j = 0; j < Derived::kColumns; ++j) {
+            out[i * Derived::kColumns + j] = self(i, j);
+        }
+    }
+}
+
+template <ElementwiseOp Op, class L, class R>
+class ElementwiseExpression : public MatrixExpression<ElementwiseExpression<Op, L, R>> {
+public:
+    using Value = typename matrix_expression_detail::Traits<L>::Value;
+    static constexpr size_t kRows = matrix_expression_detail::Traits<L>::kRows;
+    static constexpr size_t kColumns = matrix_expression_detail::Traits<L>::kColumns;
+
+    ElementwiseExpression(const L&, const R&);
+    Value operator()(const size_t&, const size_t&) const;
+    bool Refers(const void*) const;
+    bool MayAlias(const void*) const;
+    void EvaluateInto(Value*) const;
+
+private:
+    matrix_expression_detail::Stored<L> f_;
+    matrix_expression_detail::Stored<R> s_;
+};
+
+template <ElementwiseOp Op, class L, class R>
+ElementwiseExpression<Op, L, R>::ElementwiseExpression(const L& f, const R& s) : f_(f), s_(s) {
+}
+
+template <ElementwiseOp Op, class L, class R>
+typename ElementwiseExpression<Op, L, R>::Value ElementwiseExpression<Op, L, R>::operator()(const size_t& i,
+                                                                                        const size_t& j) const {
+    Value value = matrix_expression_detail::Element(f_, i, j);
+    simd_kernels_detail::Apply<Op>(value, matrix_expression_detail::Element(s_, i, j));
+    return value;
+}
+
+template <ElementwiseOp Op, class L, class R>
+bool ElementwiseExpression<Op, L, R>::Refers(const void* p) const {
+    return matrix_expression_detail::Refers(f_, p) || matrix_expression_detail::Refers(s_, p);
+}
+
+template <ElementwiseOp Op, class L, class R>
+bool ElementwiseExpression<Op, L, R>::MayAlias(const void* p) const {
+    return matrix_expression_detail::MayAlias(f_, p) || matrix_expression_detail::MayAlias(s_, p);
+}
+
+// Two plain matrices go through the vector kernel; anything deeper is one fused loop.
+template <ElementwiseOp Op, class L, class R>
+void ElementwiseExpression<Op, L, R>::EvaluateInto(Value* out) const {
+    if constexpr (matrix_expression_detail::Traits<L>::kLeaf && matrix_expression_detail::Traits<R>::kLeaf) {
+        SimdTransform<Op>(matrix_expression_detail::Data(f_), matrix_expression_detail::Data(s_), out,
+                          kRows * kColumns);
+    } else {
+        this->EvaluateFused(out);
+    }
+}
+
+template <ElementwiseOp Op, class E>
+class ScalarExpression : public MatrixExpression<ScalarExpression<Op, E>> {
+public:
+    using Value = typename matrix_expression_detail::Traits<E>::Value;
+    static constexpr size_t kRows = matrix_expression_detail::Traits<E>::kRows;
+    static constexpr size_t kColumns = matrix_expression_detail::Traits<E>::kColumns;
+
+    ScalarExpression(const E&, const int32_t&);
+    Value operator()(const size_t&, const size_t&) const;
+    bool Refers(const void*) const;
+    bool MayAlias(const void*) const;
+    void EvaluateInto(Value*) const;
+
+private:
+    matrix_expression_detail::Stored<E> f_;
+    int32_t digit_;
+};
+
+template <ElementwiseOp Op, class E>
+ScalarExpression<Op, E>::ScalarExpression(const E& f, const int32_t& digit) : f_(f), digit_(digit) {
+}
+
+template <ElementwiseOp Op, class E>
+typename ScalarExpression<Op, E>::Value ScalarExpression<Op, E>::operator()(const size_t& i, const size_t& j) const {
+    Value value = matrix_expression_detail::Element(f_, i, j);
+    simd_kernels_detail::Apply<Op>(value, digit_);
+    return value;
+}
+
+template <ElementwiseOp Op, class E>
+bool ScalarExpression<Op, E>::Refers(const void* p) const {
+    return matrix_expression_detail::Refers(f_, p);
+}
+
+template <ElementwiseOp Op, class E>
+bool ScalarExpression<Op, E>::MayAlias(const void* p) const {
+    return matrix_expression_detail::MayAlias(f_, p);
+}
+
+template <ElementwiseOp Op, class E>
+void ScalarExpression<Op, E>::EvaluateInto(Value* out) const {
+    if constexpr (matrix_expression_detail::Traits<E>::kLeaf) {
+        SimdTransformScalar<Op>(matrix_expression_detail::Data(f_), digit_, out, kRows * kColumns);
+    } else {
+        this->EvaluateFused(out);
+    }
+}
+
+template <class E>
+class TransposedExpression : public MatrixExpression<TransposedExpression<E>> {
+public:
+    using Value = typename matrix_expression_detail::Traits<E>::Value;
+    static constexpr size_t kRows = matrix_expression_detail::Traits<E>::kColumns;
+    static constexpr size_t kColumns = matrix_expression_detail::Traits<E>::kRows;
+
+    explicit TransposedExpression(const E&);
+    Value operator()(const size_t&, const size_t&) const;
+    bool Refers(const void*) const;
+    bool MayAlias(const void*) const;
+    void EvaluateInto(Value*) const;
+
+private:
+    matrix_expression_detail::Stored<E> f_;
+};
+
+template <class E>
+TransposedExpression<E>::TransposedExpression(const E& f) : f_(f) {
+}
+
+template <class E>
+typename TransposedExpression<E>::Value TransposedExpression<E>::operator()(const size_t& i, const size_t& j) const {
+    return matrix_expression_detail::Element(f_, j, i);
+}
+
+template <class E>
+bool TransposedExpression<E>::Refers(const void* p) const {
+    return matrix_expression_detail::Refers(f_, p);
+}
+
+template <class E>
+bool TransposedExpression<E>::MayAlias(const void* p) const {
+    return matrix_expression_detail::Refers(f_, p);
+}
+
+template <class E>
+void TransposedExpression<E>::EvaluateInto(Value* out) const {
+    if constexpr (matrix_expression_detail::Traits<E>::kLeaf) {
+        ParallelTranspose(matrix_expression_detail::Data(f_), kColumns, kRows, out);
+    } else {
+        this->EvaluateFused(out);
+    }
+}
+
+// A matrix as is, or an expression evaluated into a temporary; used where an operation needs real storage (GEMM).
+template <class T, size_t N, size_t M>
+const MatrixArray<T, N, M>& Materialize(const MatrixArray<T, N, M>& m) {
+    return m;
+}
+
+template <MatrixExpressionNode X>
+auto Materialize(const X& x) {
+    return x.Evaluate();
+}
+
+// Writes e into m, through a temporary when e reads m at positions other than the one being written.
+template <class T, size_t N, size_t M, MatrixExpressionNode E>
+void AssignExpression(MatrixArray<T, N, M>& m, const E& e) {
+    if (e.MayAlias(&m)) {
+        m.Copy(e.Evaluate());
+    } else {
+        e.EvaluateInto(&m.buffer_[0][0]);
+    }
+}
+
+// m op= e element-wise without materializing e unless it may alias m.
+template <ElementwiseOp Op, class T, size_t N, size_t M, class E>
+void ApplyExpression(MatrixArray<T, N, M>& m, const E& e) {
+    if constexpr (matrix_expression_detail::Traits<E>::kLeaf) {
+        SimdTransform<Op>(&m.buffer_[0][0], &e.buffer_[0][0], &m.buffer_[0][0], N * M);
+    } else {
+        if (e.MayAlias(&m)) {
+            ApplyExpression<Op>(m, e.Evaluate());
+            return;
+        }
+        for (size_t i = 0; i < N; ++i) {
+            for (size_t j = 0; j < M; ++j) {
+                simd_kernels_detail::Apply<Op>(m.buffer_[i][j], e(i, j));
+            }
+        }
+    }
+}
+
+#endif  // MATRIX_ARRAY_MATRIX_EXPRESSION_H
@@ -0,0 +1,57 @@
+#ifndef MATRIX_ARRAY_MATRIX_PARALLEL_H
+#define MATRIX_ARRAY_MATRIX_PARALLEL_H
+
+#include <util/thread_pool.h>
+#include <simd_kernels.h>
+#include <algorithm>
+#include <cstddef>
+
+const size_t kMatrixParallelCutoff = 1 << 18;
+
+// Calls function(first, last) for consecutive blocks of rows [begin, end), one task in DefaultThreadPool() per block.
+// A block is a multiple of step rows costing at least kMatrixParallelCutoff, row_cost being the cost of one row, so
+// small loops run on the calling thread as one block. Blocks depend only on the sizes, and callers process every row
+// the same way whatever block it falls in, so results do not depend on the number of threads.
+template <class Function>
+void ForEachRowBlock(const size_t& begin, const size_t& end, const size_t& row_cost, const size_t& step,
+                     Function&& function) {
+    size_t rows = std::max<size_t>(1, kMatrixParallelCutoff / std::max<size_t>(1, row_cost));
+    rows = (rows + step - 1) / step * step;
+    if (end <= begin + rows) {
+        if (begin < end) {
+            function(begin, end);
+        }
+        return;
+    }
+    TaskGroup group(DefaultThreadPool());
+    for (size_t first = begin + rows; first < end; first += rows) {
+        group.Run([&function, first, last = std::min(first + rows, end)] { function(first, last); });
+    }
+    function(begin, begin + rows);
+    group.Wait();
+}
+
+// dst[columns x rows] = transposed src[rows x columns], split into bands of kTransposeTile-multiple source rows.
+template <class T>
+void ParallelTranspose(const T* src, const size_t& rows, const size_t& columns, T* dst) {
+    ForEachRowBlock(0, rows, columns, kTransposeTile, [&](const size_t& first, const size_t& last) {
+        SimdTranspose(src + first * columns, columns, last - first, columns, dst + first, rows);
+    });
+}
+
+// Square row-major n x n matrix a transposed in place by kTransposeTile tiles: the tiles of row I at and right of the
+// diagonal are swapped with their mirror images, so tile rows touch disjoint tile pairs and run in parallel.
+template <class T>
+void ParallelTransposeInPlace(T* a, const size_t& n) {
+    size_t tiles = (n + kTransposeTile - 1) / kTransposeTile;
+    ForEachRowBlock(0, tiles, n * kTransposeTile, 1, [&](const size_t& first, const size_t& last) {
+        for (size_t i = first * kTransposeTile; i < std::min(last * kTransposeTile, n); i += kTransposeTile) {
+            size_t rows = std::min(kTransposeTile, n - i);
+            for (size_t j = i; j < n; j += kTransposeTile) {
+                SimdSwapTransposed(a + i * n + j, a + j * n + i, n, rows, std::min(kTransposeTile, n - j));
+            }
+        }
+    });
+}
+
+#endif  // MATRIX_ARRAY_MATRIX_PARALLEL_H
@@ -0,0 +1,456 @@
+#ifndef MATRIX_ARRAY_SIMD_KERNELS_H
+#define MATRIX_ARRAY_SIMD_KERNELS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#if defined(__x86_64__) || defined(__i386__)
+#define MATRIX_ARRAY_SIMD_X86
+#include <immintrin.h>
+#endif
+
+enum class SimdLevel { kScalar, kSse2, kAvx2, kAvx512 };
+
+enum class ElementwiseOp { kAdd, kSubtract, kMultiply, kDivide };
+
+template <class T>
+concept SimdArithmetic = std::is_same_v<T, float> || std::is_same_v<T, double> || std::is_same_v<T, int32_t>;
+
+// The instruction set is chosen once at run time, so a binary built for the baseline target still uses AVX2/AVX-512.
+inline SimdLevel DetectSimdLevel() {
+#ifdef MATRIX_ARRAY_SIMD_X86
+    static const SimdLevel kLevel = [] {
+        __builtin_cpu_init();
+        bool fma = __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma");
+        if (fma && __builtin_cpu_supports("avx512f")) {
+            return SimdLevel::kAvx512;
+        }
+        if (fma) {
+            return SimdLevel::kAvx2;
+        }
+        return __builtin_cpu_supports("sse2") ? SimdLevel::kSse2 : SimdLevel::kScalar;
+    }();
+    return kLevel;
+#else
+    return SimdLevel::kScalar;
+#endif
+}
+
+namespace simd_kernels_detail {
+
+template <class T, size_t Bytes>
+using Vector [[gnu::vector_size(Bytes)]] = T;
+
+template <ElementwiseOp Op, class U, class V>
+[[gnu::always_inline]] inline void Apply(U& f, const V& s) {
+    if constexpr (Op == ElementwiseOp::kAdd) {
+        f += s;
+    } else if constexpr (Op == ElementwiseOp::kSubtract) {
+        f -= s;
+    } else if constexpr (Op == ElementwiseOp::kMultiply) {
+        f *= s;
+    } else {
+        f /= s;
+    }
+}
+
+template <ElementwiseOp Op, class T, class S>
+void Transform(const T* f, const S* s, T* out, const size_t& n) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = f[i];
+        Apply<Op>(out[i], s[i]);
+    }
+}
+
+template <ElementwiseOp Op, class T, class S>
+void TransformScalar(const T* f, const S& s, T* out, const size_t& n) {
+    for (size_t i = 0; i < n; ++i) {
+        out[i] = f[i];
+        Apply<Op>(out[i], s);
+    }
+}
+
+// Whole vectors are moved with memcpy, which compiles to unaligned vector loads and stores, out may alias f.
+template <ElementwiseOp Op, size_t Bytes, class T>
+[[gnu::always_inline]] inline void TransformVectors(const T* f, const T* s, T* out, const size_t& n) {
+    constexpr size_t kLanes = Bytes / sizeof(T);
+    size_t i = 0;
+    for (; i + kLanes <= n; i += kLanes) {
+        Vector<T, Bytes> x;
+        Vector<T, Bytes> y;
+        std::memcpy(&x, f + i, Bytes);
+        std::memcpy(&y, s + i, Bytes);
+        Apply<Op>(x, y);
+        std::memcpy(out + i, &x, Bytes);
+    }
+    Transform<Op>(f + i, s + i, out + i, n - i);
+}
+
+template <ElementwiseOp Op, size_t Bytes, class T>
+[[gnu::always_inline]] inline void TransformScalarVectors(const T* f, const T& s, T* out, const size_t& n) {
+    constexpr size_t kLanes = Bytes / sizeof(T);
+    Vector<T, Bytes> y = Vector<T, Bytes>{} + s;
+    size_t i = 0;
+    for (; i + kLanes <= n; i += kLanes) {
+        Vector<T, Bytes> x;
+        std::memcpy(&x, f + i, Bytes);
+        Apply<Op>(x, y);
+        std::memcpy(out + i, &x, Bytes);
+    }
+    TransformScalar<Op>(f + i, s, out + i, n - i);
+}
+
+template <class T, class Kernel>
+void TransposeBlocks(const T* src, const size_t& lds, const size_t& rows, const size_t& columns, T* dst,
+                     const size_t& ldd, const size_t& block, Kernel kernel) {
+    size_t height = rows / block * block;
+    size_t width = columns / block * block;
+    for (size_t i = 0; i < height; i += block) {
+        for (size_t j = 0; j < width; j += block) {
+            kernel(src + i * lds + j, lds, dst + j * ldd + i, ldd);
+        }
+    }
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = i < height ? width : 0; j < columns; ++j) {
+            dst[j * ldd + i] = src[i * lds + j];
+        }
+    }
+}
+
+#ifdef MATRIX_ARRAY_SIMD_X86
+
+template <ElementwiseOp Op, class T>
+[[gnu::target("avx512f")]] void TransformAvx512(const T* f, const T* s, T* out, const size_t& n) {
+    TransformVectors<Op, 64>(f, s, out, n);
+}
+
+template <ElementwiseOp Op, class T>
+[[gnu::target("avx2")]] void TransformAvx2(const T* f, const T* s, T* out, const size_t& n) {
+    TransformVectors<Op, 32>(f, s, out, n);
+}
+
+template <ElementwiseOp Op, class T>
+[[gnu::target("sse2")]] void TransformSse2(const T* f, const T* s, T* out, const size_t& n) {
+    TransformVectors<Op, 16>(f, s, out, n);
+}
+
+template <ElementwiseOp Op, class T>
+[[gnu::target("avx512f")]] void TransformScalarAvx512(const T* f, const T& s, T* out, const size_t& n) {
+    TransformScalarVectors<Op, 64>(f, s, out, n);
+}
+
+template <ElementwiseOp Op, class T>
+[[gnu::target("avx2")]] void TransformScalarAvx2(const T* f, const T& s, T* out, const size_t& n) {
+    TransformScalarVectors<Op, 32>(f, s, out, n);
+}
+
+template <ElementwiseOp Op, class T>
+[[gnu::target("sse2")]] void TransformScalarSse2(const T* f, const T& s, T* out, const size_t& n) {
+    TransformScalarVectors<Op, 16>(f, s, out, n);
+}
+
+// The register transposes move 32-bit elements of any type as floats and 64-bit ones as doubles. Only the unaligned
+// load and store intrinsics, which may alias any type, see the pointers as float or double.
+template <class T>
+[[gnu::target("avx")]] void Transpose8x8Avx(const T* src, const size_t& lds, T* dst, const size_t& ldd) {
+    __m256 r[8];
+    __m256 t[8];
+    for (size_t i = 0; i < 8; ++i) {
+        r[i] = _mm256_loadu_ps(reinterpret_cast<const float*>(src + i * lds));
+    }
+    for (size_t i = 0; i < 8; i += 2) {
+        t[i] = _mm256_unpacklo_ps(r[i], r[i + 1]);
+        t[i + 1] = _mm256_unpackhi_ps(r[i], r[i + 1]);
+    }
+    for (size_t i = 0; i < 8; i += 4) {
+        r[i] = _mm256_shuffle_ps(t[i], t[i + 2], _MM_SHUFFLE(1, 0, 1, 0));
+        r[i + 1] = _mm256_shuffle_ps(t[i], t[i + 2], _MM_SHUFFLE(3, 2, 3, 2));
+        r[i + 2] = _mm256_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(1, 0, 1, 0));
+        r[i + 3] = _mm256_shuffle_ps(t[i + 1], t[i + 3], _MM_SHUFFLE(3, 2, 3, 2));
+    }
+    for (size_t i = 0; i < 4; ++i) {
+        _mm256_storeu_ps(reinterpret_cast<float*>(dst + i * ldd), _mm256_permute2f128_ps(r[i], r[i + 4], 0x20));
+        _mm256_storeu_ps(reinterpret_cast<float*>(dst + (i + 4) * ldd), _mm256_permute2f128_ps(r[i], r[i + 4], 0x31));
+    }
+}
+
+template <class T>
+[[gnu::target("avx")]] void Transpose4x4Avx(const T* src, const size_t& lds, T* dst, const size_t& ldd) {
+    __m256d r0 = _mm256_loadu_pd(reinterpret_cast<const double*>(src));
+    __m256d r1 = _mm256_loadu_pd(reinterpret_cast<const double*>(src + lds));
+    __m256d r2 = _mm256_loadu_pd(reinterpret_cast<const double*>(src + 2 * lds));
+    __m256d r3 = _mm256_loadu_pd(reinterpret_cast<const double*>(src + 3 * lds));
+    __m256d t0 = _mm256_unpacklo_pd(r0, r1);
+    __m256d t1 = _mm256_unpackhi_pd(r0, r1);
+    __m256d t2 = _mm256_unpacklo_pd(r2, r3);
+    __m256d t3 = _mm256_unpackhi_pd(r2, r3);
+    _mm256_storeu_pd(reinterpret_cast<double*>(dst), _mm256_permute2f128_pd(t0, t2, 0x20));
+    _mm256_storeu_pd(reinterpret_cast<double*>(dst + ldd), _mm256_permute2f128_pd(t1, t3, 0x20));
+    _mm256_storeu_pd(reinterpret_cast<double*>(dst + 2 * ldd), _mm256_permute2f128_pd(t0, t2, 0x31));
+    _mm256_storeu_pd(reinterpret_cast<double*>(dst + 3 * ldd), _mm256_permute2f128_pd(t1, t3, 0x31));
+}
+
+template <class T>
+[[gnu::target("sse2")]] void Transpose4x4Sse2(const T* src, const size_t& lds, T* dst, const size_t& ldd) {
+    __m128 r0 = _mm_loadu_ps(reinterpret_cast<const float*>(src));
+    __m128 r1 = _mm_loadu_ps(reinterpret_cast<const float*>(src + lds));
+    __m128 r2 = _mm_loadu_ps(reinterpret_cast<const float*>(src + 2 * lds));
+    __m128 r3 = _mm_loadu_ps(reinterpret_cast<const float*>(src + 3 * lds));
+    _MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+    _mm_storeu_ps(reinterpret_cast<float*>(dst), r0);
+    _mm_storeu_ps(reinterpret_cast<float*>(dst + ldd), r1);
+    _mm_storeu_ps(reinterpret_cast<float*>(dst + 2 * ldd), r2);
+    _mm_storeu_ps(reinterpret_cast<float*>(dst + 3 * ldd), r3);
+}
+
+template <class T>
+[[gnu::target("sse2")]] void Transpose2x2Sse2(const T* src, const size_t& lds, T* dst, const size_t& ldd) {
+    __m128d r0 = _mm_loadu_pd(reinterpret_cast<const double*>(src));
+    __m128d r1 = _mm_loadu_pd(reinterpret_cast<const double*>(src + lds));
+    _mm_storeu_pd(reinterpret_cast<double*>(dst), _mm_unpacklo_pd(r0, r1));
+    _mm_storeu_pd(reinterpret_cast<double*>(dst + ldd), _mm_unpackhi_pd(r0, r1));
+}
+
+// Register block of the product: Rows rows of c by two vectors are kept in registers for the whole depth, each loaded
+// vector of b feeds Rows fused multiply-adds. Only the leading Rows-multiple rows and two-vector-multiple columns are
+// updated; the number of updated columns is returned.
+template <size_t Rows, class T>
+[[gnu::target("avx2,fma")]] size_t GemmFmaAvx2(const T* a, const size_t& lda, const T* b, const size_t& ldb, T* c,
+                                               const size_t& ldc, const size_t& rows, const size_t& depth,
+                                               const size_t& columns) {
+    using Register = Vector<T, 32>;
+    constexpr size_t kLanes = 32 / sizeof(T);
+    size_t height = rows / Rows * Rows;
+    size_t width = columns / (2 * kLanes) * (2 * kLanes);
+    for (size_t i = 0; i < height; i += Rows) {
+        for (size_t j = 0; j < width; j += 2 * kLanes) {
+            Register accumulator[Rows][2];
+            for (size_t r = 0; r < Rows; ++r) {
+                std::memcpy(accumulator[r], c + (i + r) * ldc + j, sizeof(accumulator[r]));
+            }
+            for (size_t p = 0; p < depth; ++p) {
+                Register row[2];
+                std::memcpy(row, b + p * ldb + j, sizeof(row));
+                for (size_t r = 0; r < Rows; ++r) {
+                    Register x = Register{} + a[(i + r) * lda + p];
+                    for (size_t h = 0; h < 2; ++h) {
+                        if constexpr (std::is_same_v<T, float>) {
+                            accumulator[r][h] = _mm256_fmadd_ps(x, row[h], accumulator[r][h]);
+                        } else {
+                            accumulator[r][h] = _mm256_fmadd_pd(x, row[h], accumulator[r][h]);
+                        }
+                    }
+                }
+            }
+            for (size_t r = 0; r < Rows; ++r) {
+                std::memcpy(c + (i + r) * ldc + j, accumulator[r], sizeof(accumulator[r]));
+            }
+        }
+    }
+    return height == 0 ? 0 : width;
+}
+
+template <size_t Rows, class T>
+[[gnu::target("avx512f")]] size_t GemmFmaAvx512(const T* a, const size_t& lda, const T* b, const size_t& ldb, T* c,
+                                                const size_t& ldc, const size_t& rows, const size_t& depth,
+                                                const size_t& columns) {
+    using Register = Vector<T, 64>;
+    constexpr size_t kLanes = 64 / sizeof(T);
+    size_t height = rows / Rows * Rows;
+    size_t width = columns / (2 * kLanes) * (2 * kLanes);
+    for (size_t i = 0; i < height; i += Rows) {
+        for (size_t j = 0; j < width; j += 2 * kLanes) {
+            Register accumulator[Rows][2];
+            for (size_t r = 0; r < Rows; ++r) {
+                std::memcpy(accumulator[r], c + (i + r) * ldc + j, sizeof(accumulator[r]));
+            }
+            for (size_t p = 0; p < depth; ++p) {
+                Register row[2];
+                std::memcpy(row, b + p * ldb + j, sizeof(row));
+                for (size_t r = 0; r < Rows; ++r) {
+                    Register x = Register{} + a[(i + r) * lda + p];
+                    for (size_t h = 0; h < 2; ++h) {
+                        if constexpr (std::is_same_v<T, float>) {
+                            accumulator[r][h] = _mm512_fmadd_ps(x, row[h], accumulator[r][h]);
+                        } else {
+                            accumulator[r][h] = _mm512_fmadd_pd(x, row[h], accumulator[r][h]);
+                        }
+                    }
+                }
+            }
+            for (size_t r = 0; r < Rows; ++r) {
+                std::memcpy(c + (i + r) * ldc + j, accumulator[r], sizeof(accumulator[r]));
+            }
+        }
+    }
+    return height == 0 ? 0 : width;
+}
+
+#endif
+
+}  // namespace simd_kernels_detail
+
+// out = f op s elementwise; out may coincide with f or s.
+template <ElementwiseOp Op, class T>
+void SimdTransform(const T* f, const T* s, T* out, const size_t& n) {
+#ifdef MATRIX_ARRAY_SIMD_X86
+    if constexpr (SimdArithmetic<T>) {
+        switch (DetectSimdLevel()) {
+            case SimdLevel::kAvx512:
+                simd_kernels_detail::TransformAvx512<Op>(f, s, out, n);
+                return;
+            case SimdLevel::kAvx2:
+                simd_kernels_detail::TransformAvx2<Op>(f, s, out, n);
+                return;
+            case SimdLevel::kSse2:
+                simd_kernels_detail::TransformSse2<Op>(f, s, out, n);
+                return;
+            default:
+                break;
+        }
+    }
+#endif
+    simd_kernels_detail::Transform<Op>(f, s, out, n);
+}
+
+// out = f op s with a scalar s, which is converted to T once for arithmetic T.
+template <ElementwiseOp Op, class T, class S>
+void SimdTransformScalar(const T* f, const S& s, T* out, const size_t& n) {
+#ifdef MATRIX_ARRAY_SIMD_X86
+    if constexpr (SimdArithmetic<T>) {
+        T value = static_cast<T>(s);
+        switch (DetectSimdLevel()) {
+            case SimdLevel::kAvx512:
+                simd_kernels_detail::TransformScalarAvx512<Op>(f, value, out, n);
+                return;
+            case SimdLevel::kAvx2:
+                simd_kernels_detail::TransformScalarAvx2<Op>(f, value, out, n);
+                return;
+            case SimdLevel::kSse2:
+                simd_kernels_detail::TransformScalarSse2<Op>(f, value, out, n);
+                return;
+            default:
+                break;
+        }
+    }
+#endif
+    simd_kernels_detail::TransformScalar<Op>(f, s, out, n);
+}
+
+const size_t kTransposeTile = 32;
+
+// dst[columns x rows] = transposed src[rows x columns], rows of src lds and rows of dst ldd elements apart; full 8x8
+// (32-bit) or 4x4 (double) blocks are transposed in registers, the edges element by element.
+template <class T>
+void SimdTransposeTile(const T* src, const size_t& lds, const size_t& rows, const size_t& columns, T* dst,
+                       const size_t& ldd) {
+#ifdef MATRIX_ARRAY_SIMD_X86
+    if constexpr (SimdArithmetic<T>) {
+        SimdLevel level = DetectSimdLevel();
+        if (level >= SimdLevel::kAvx2) {
+            if constexpr (sizeof(T) == sizeof(float)) {
+                simd_kernels_detail::TransposeBlocks(src, lds, rows, columns, dst, ldd, 8,
+                                                     simd_kernels_detail::Transpose8x8Avx<T>);
+            } else {
+                simd_kernels_detail::TransposeBlocks(src, lds, rows, columns, dst, ldd, 4,
+                                                     simd_kernels_detail::Transpose4x4Avx<T>);
+            }
+            return;
+        }
+        if (level == SimdLevel::kSse2) {
+            if constexpr (sizeof(T) == sizeof(float)) {
+                simd_kernels_detail::TransposeBlocks(src, lds, rows, columns, dst, ldd, 4,
+                                                     simd_kernels_detail::Transpose4x4Sse2<T>);
+            } else {
+                simd_kernels_detail::TransposeBlocks(src, lds, rows, columns, dst, ldd, 2,
+                                                     simd_kernels_detail::Transpose2x2Sse2<T>);
+            }
+            return;
+        }
+    }
+#endif
+    for (size_t i = 0; i < rows; ++i) {
+        for (size_t j = 0; j < columns; ++j) {
+            dst[j * ldd + i] = src[i * lds + j];
+        }
+    }
+}
+
+// Same as SimdTransposeTile for any size. The longer side is halved, at a multiple of 8, until the block fits in a
+// kTransposeTile square, so the source and destination lines of a block stay in cache whatever its size.
+template <class T>
+void SimdTranspose(const T* src, const size_t& lds, const size_t& rows, const size_t& columns, T* dst,
+                   const size_t& ldd) {
+    if (rows <= kTransposeTile && columns <= kTransposeTile) {
+        SimdTransposeTile(src, lds, rows, columns, dst, ldd);
+    } else if (rows >= columns) {
+        size_t half = (rows / 2 + 7) / 8 * 8;
+        SimdTranspose(src, lds, half, columns, dst, ldd);
+        SimdTranspose(src + half * lds, lds, rows - half, columns, dst + half, ldd);
+    } else {
+        size_t half = (columns / 2 + 7) / 8 * 8;
+        SimdTranspose(src, lds, rows, half, dst, ldd);
+        SimdTranspose(src + half, lds, rows, columns - half, dst + half * ldd, ldd);
+    }
+}
+
+template <class T>
+void SimdTranspose(const T* src, const size_t& rows, const size_t& columns, T* dst) {
+    SimdTranspose(src, columns, rows, columns, dst, rows);
+}
+
+// Exchanges the rows x columns block at f with the columns x rows block at s, transposing both; f == s transposes a
+// square block in place. Rows of both blocks are ld elements apart and blocks are at most kTransposeTile on a side.
+// Vector types go through a transposed copy of f on the stack.
+template <class T>
+void SimdSwapTransposed(T* f, T* s, const size_t& ld, const size_t& rows, const size_t& columns) {
+    if constexpr (SimdArithmetic<T>) {
+        T tile[kTransposeTile * kTransposeTile];
+        SimdTransposeTile(f, ld, rows, columns, tile, rows);
+        if (f != s) {
+            SimdTransposeTile(s, ld, columns, rows, f, ld);
+        }
+        for (size_t i = 0; i < columns; ++i) {
+            std::memcpy(s + i * ld, tile + i * rows, rows * sizeof(T));
+        }
+    } else if (f == s) {
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = i + 1; j < columns; ++j) {
+                std::swap(f[i * ld + j], f[j * ld + i]);
+            }
+        }
+    } else {
+        for (size_t i = 0; i < rows; ++i) {
+            for (size_t j = 0; j < columns; ++j) {
+                std::swap(f[i * ld + j], s[j * ld + i]);
+            }
+        }
+    }
+}
+
+// Register-blocked FMA update c += a * b of the leading Rows-multiple rows of float and double blocks. Returns how many
+// leading columns were updated, 0 when no vector kernel applies.
+template <size_t Rows, class T>
+size_t SimdGemmBlock(const T* a, const size_t& lda, const T* b, const size_t& ldb, T* c, const size_t& ldc,
+                     const size_t& rows, const size_t& depth, const size_t& columns) {
+#ifdef MATRIX_ARRAY_SIMD_X86
+    if constexpr (std::is_same_v<T, float> || std::is_same_v<T, double>) {
+        switch (DetectSimdLevel()) {
+            case SimdLevel::kAvx512: {
+                size_t done = simd_kernels_detail::GemmFmaAvx512<Rows>(a, lda, b, ldb, c, ldc, rows, depth, columns);
+                return done + simd_kernels_detail::GemmFmaAvx2<Rows>(a, lda, b + done, ldb, c + done, ldc, rows,
+                                                                     depth, columns - done);
+            }
+            case SimdLevel::kAvx2:
+                return simd_kernels_detail::GemmFmaAvx2<Rows>(a, lda, b, ldb, c, ldc, rows, depth, columns);
+            default:
+                break;
+        }
+    }
+#endif
+    return 0;
+}
+
+#endif  // MATRIX_ARRAY_SIMD_KERNELS_H
@@ -0,0 +1,566 @@
+#ifndef MATRIX_ARRAY_MATRIX_H
+#define MATRIX_ARRAY_MATRIX_H
+
+#include "matrix_array.h"
+#include <algorithm>
+#include <cstddef>
+#include <exception>
+#include <iomanip>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+const size_t kMatrixAlignment = 64;
+
+class MatrixSizeMismatch : public std::invalid_argument {
+public:
+    MatrixSizeMismatch() : std::invalid_argument("MatrixSizeMismatch") {
+    }
+};
+
+// Non-owning window into row-major storage: rows_ x columns_ elements, consecutive rows stride_ elements apart. T is
+// const-qualified for read-only views. Views are taken of Matrix and MatrixArray alike, so the two interoperate
+// without copies.
+template <class T>
+struct MatrixView {
+    T* data_;
+    size_t rows_;
+    size_t columns_;
+    size_t stride_;
+
+    MatrixView(T*, const size_t&, const size_t&, const size_t&);
+    template <size_t N, size_t M>
+    MatrixView(MatrixArray<std::remove_const_t<T>, N, M>&);  //  NOLINT
+    template <size_t N, size_t M>
+    MatrixView(const MatrixArray<std::remove_const_t<T>, N, M>&) requires std::is_const_v<T>;  //  NOLINT
+    MatrixView(const MatrixView<std::remove_const_t<T>>&) requires std::is_const_v<T>;          //  NOLINT
+    size_t RowsNumber() const;
+    size_t ColumnsNumber() const;
+    size_t Stride() const;
+    T* Data() const;
+    bool IsContiguous() const;
+    T& operator()(const size_t&, const size_t&) const;
+    T& At(const size_t&, const size_t&) const;
+    MatrixView<T> Block(const size_t&, const size_t&, const size_t&, const size_t&) const;
+};
+
+template <class T>
+MatrixView<T>::MatrixView(T* data, const size_t& rows, const size_t& columns, const size_t& stride)
+    : data_(data), rows_(rows), columns_(columns), stride_(stride) {
+}
+
+template <class T>
+template <size_t N, size_t M>
+MatrixView<T>::MatrixView(MatrixArray<std::remove_const_t<T>, N, M>& m) : MatrixView(&m.buffer_[0][0], N, M, M) {
+}
+
+template <class T>
+template <size_t N, size_t M>
+MatrixView<T>::MatrixView(const MatrixArray<std::remove_const_t<T>, N, M>& m) requires std::is_const_v<T>
+    : MatrixView(&m.buffer_[0][0], N, M, M) {
+}
+
+template <class T>
+MatrixView<T>::MatrixView(const MatrixView<std::remove_const_t<T>>& other) requires std::is_const_v<T>
+    : MatrixView(other.data_, other.rows_, other.columns_, other.stride_) {
+}
+
+template <class T>
+size_t MatrixView<T>::RowsNumber() const {
+    return rows_;
+}
+
+template <class T>
+size_t MatrixView<T>::ColumnsNumber() const {
+    return columns_;
+}
+
+template <class T>
+size_t MatrixView<T>::Stride() const {
+    return stride_;
+}
+
+template <class T>
+T* MatrixView<T>::Data() const {
+    return data_;
+}
+
+template <class T>
+bool MatrixView<T>::IsContiguous() const {
+    return stride_ == columns_ || rows_ <= 1;
+}
+
+template <class T>
+T& MatrixView<T>::operator()(const size_t& row, const size_t& column) const {
+    return data_[row * stride_ + column];
+}
+
+template <class T>
+T& MatrixView<T>::At(const size_t& row, const size_t& column) const {
+    if (row >= rows_ || column >= columns_) {
+        throw MatrixArrayOutOfRange{};
+    }
+    return data_[row * stride_ + column];
+}
+
+template <class T>
+MatrixView<T> MatrixView<T>::Block(const size_t& row, const size_t& column, const size_t& rows,
+                                   const size_t& columns) const {
+    if (row + rows > rows_ || column + columns > columns_) {
+        throw MatrixArrayOutOfRange{};
+    }
+    return {data_ + row * stride_ + column, rows, columns, stride_};
+}
+
+// Runtime-sized counterpart of MatrixArray. Elements live in one contiguous row-major heap block aligned to
+// kMatrixAlignment, so moving a matrix is O(1) and large matrices never touch the stack.
+template <class T>
+class Matrix {
+public:
+    Matrix();
+    Matrix(const size_t&, const size_t&);
+    Matrix(const size_t&, const size_t&, const T&);
+    explicit Matrix(const MatrixView<const T>&);
+    template <size_t N, size_t M>
+    explicit Matrix(const MatrixArray<T, N, M>&);
+    Matrix(const Matrix<T>&);
+    Matrix(Matrix<T>&&) noexcept;
+    Matrix<T>& operator=(const Matrix<T>&);
+    Matrix<T>& operator=(Matrix<T>&&) noexcept;
+    ~Matrix();
+    size_t RowsNumber() const;
+    size_t ColumnsNumber() const;
+    size_t Size() const;
+    T* Data();
+    const T* Data() const;
+    const T& operator()(const size_t&, const size_t&) const;
+    T& operator()(const size_t&, const size_t&);
+    T At(const size_t&, const size_t&) const;
+    T& At(const size_t&, const size_t&);
+    MatrixView<T> GetView();
+    MatrixView<const T> GetView() const;
+    MatrixView<T> Block(const size_t&, const size_t&, const size_t&, const size_t&);
+    MatrixView<const T> Block(const size_t&, const size_t&, const size_t&, const size_t&) const;
+    Matrix<T> GetTransposed() const;
+    bool operator==(const Matrix<T>&) const;
+    bool operator!=(const Matrix<T>&) const;
+    Matrix<T>& Transpose();
+    T Trace() const;
+    T Determinant() const;
+    Matrix<T>& Inverse();
+    Matrix<T> GetInversed() const&;
+    Matrix<T> GetInversed() &&;
+    Matrix<T>& ToUnit();
+    void Swap(Matrix<T>&);
+
+private:
+    T* buffer_;
+    size_t rows_;
+    size_t columns_;
+
+    static T* Allocate(const size_t&);
+    static void Deallocate(T*);
+    void CheckSquare() const;
+};
+
+template <class T>
+T* Matrix<T>::Allocate(const size_t& count) {
+    if (count == 0) {
+        return nullptr;
+    }
+    return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t{kMatrixAlignment}));
+}
+
+template <class T>
+void Matrix<T>::Deallocate(T* buffer) {
+    if (buffer != nullptr) {
+        ::operator delete(buffer, std::align_val_t{kMatrixAlignment});
+    }
+}
+
+template <class T>
+void Matrix<T>::CheckSquare() const {
+    if (rows_ != columns_) {
+        throw MatrixSizeMismatch{};
+    }
+}
+
+template <class T>
+Matrix<T>::Matrix() : buffer_(nullptr), rows_(0), columns_(0) {
+}
+
+template <class T>
+Matrix<T>::Matrix(const size_t& rows, const size_t& columns)
+    : buffer_(Allocate(rows * columns)), rows_(rows), columns_(columns) {
+    try {
+        std::uninitialized_value_construct_n(buffer_, Size());
+    } catch (...) {
+        Deallocate(buffer_);
+        throw;
+    }
+}
+
+template <class T>
+Matrix<T>::Matrix(const size_t& rows, const size_t& columns, const T& value)
+    : buffer_(Allocate(rows * columns)), rows_(rows), columns_(columns) {
+    try {
+        std::uninitialized_fill_n(buffer_, Size(), value);
+    } catch (...) {
+        Deallocate(buffer_);
+        throw;
+    }
+}
+
+template <class T>
+Matrix<T>::Matrix(const MatrixView<const T>& view)
+    : buffer_(Allocate(view.rows_ * view.columns_)), rows_(view.rows_), columns_(view.columns_) {
+    size_t row = 0;
+    try {
+        for (; row < rows_; ++row) {
+            std::uninitialized_copy_n(view.data_ + row * view.stride_, columns_, buffer_ + row * columns_);
+        }
+    } catch (...) {
+        std::destroy_n(buffer_, row * columns_);
+        Deallocate(buffer_);
+        throw;
+    }
+}
+
+template <class T>
+template <size_t N, size_t M>
+Matrix<T>::Matrix(const MatrixArray<T, N, M>& m) : Matrix(MatrixView<const T>(m)) {
+}
+
+template <class T>
+Matrix<T>::Matrix(const Matrix<T>& other) : Matrix(other.GetView()) {
+}
+
+template <class T>
+Matrix<T>::Matrix(Matrix<T>&& other) noexcept
+    : buffer_(std::exchange(other.buffer_, nullptr))
+    , rows_(std::exchange(other.rows_, 0))
+    , columns_(std::exchange(other.columns_, 0)) {
+}
+
+template <class T>
+Matrix<T>& Matrix<T>::operator=(const Matrix<T>& other) {
+    if (this != &other) {
+        Matrix<T> copy(other);
+        Swap(copy);
+    }
+    return *this;
+}
+
+template <class T>
+Matrix<T>& Matrix<T>::operator=(Matrix<T>&& other) noexcept {
+    Matrix<T> moved(std::move(other));
+    Swap(moved);
+    return *this;
+}
+
+template <class T>
+Matrix<T>::~Matrix() {
+    std::destroy_n(buffer_, Size());
+    Deallocate(buffer_);
+}
+
+template <class T>
+void Matrix<T>::Swap(Matrix<T>& other) {
+    std::swap(buffer_, other.buffer_);
+    std::swap(rows_, other.rows_);
+    std::swap(columns_, other.columns_);
+}
+
+template <class T>
+size_t Matrix<T>::RowsNumber() const {
+    return rows_;
+}
+
+template <class T>
+size_t Matrix<T>::ColumnsNumber() const {
+    return columns_;
+}
+
+template <class T>
+size_t Matrix<T>::Size() const {
+    return rows_ * columns_;
+}
+
+template <class T>
+T* Matrix<T>::Data() {
+    return buffer_;
+}
+
+template <class T>
+const T* Matrix<T>::Data() const {
+    return buffer_;
+}
+
+template <class T>
+const T& Matrix<T>::operator()(const size_t& row, const size_t& column) const {
+    return buffer_[row * columns_ + column];
+}
+
+template <class T>
+T& Matrix<T>::operator()(const size_t& row, const size_t& column) {
+    return buffer_[row * columns_ + column];
+}
+
+template <class T>
+T Matrix<T>::At(const size_t& row, const size_t& column) const {
+    if (row >= rows_ || column >= columns_) {
+        throw MatrixArrayOutOfRange{};
+    }
+    return buffer_[row * columns_ + column];
+}
+
+template <class T>
+T& Matrix<T>::At(const size_t& row, const size_t& column) {
+    if (row >= rows_ || column >= columns_) {
+        throw MatrixArrayOutOfRange{};
+    }
+    return buffer_[row * columns_ + column];
+}
+
+template <class T>
+MatrixView<T> Matrix<T>::GetView() {
+    return {buffer_, rows_, columns_, columns_};
+}
+
+template <class T>
+MatrixView<const T> Matrix<T>::GetView() const {
+    return {buffer_, rows_, columns_, columns_};
+}
+
+template <class T>
+MatrixView<T> Matrix<T>::Block(const size_t& row, const size_t& column, const size_t& rows, const size_t& columns) {
+    return GetView().Block(row, column, rows, columns);
+}
+
+template <class T>
+MatrixView<const T> Matrix<T>::Block(const size_t& row, const size_t& column, const size_t& rows,
+                                     const size_t& columns) const {
+    return GetView().Block(row, column, rows, columns);
+}
+
+template <class T>
+Matrix<T> Matrix<T>::GetTransposed() const {
+    Matrix<T> transposed(columns_, rows_);
+    ParallelTranspose(buffer_, rows_, columns_, transposed.buffer_);
+    return transposed;
+}
+
+template <class T>
+bool Matrix<T>::operator==(const Matrix<T>& other) const {
+    return rows_ == other.rows_ && columns_ == other.columns_ && std::equal(buffer_, buffer_ + Size(), other.buffer_);
+}
+
+template <class T>
+bool Matrix<T>::operator!=(const Matrix<T>& other) const {
+    return !(*this == other);
+}
+
+template <class T>
+Matrix<T>& Matrix<T>::Transpose() {
+    if (rows_ != columns_) {
+        *this = GetTransposed();
+        return *this;
+    }
+    ParallelTransposeInPlace(buffer_, rows_);
+    return *this;
+}
+
+template <class T>
+T Matrix<T>::Trace() const {
+    CheckSquare();
+    auto trace = kZero<T>;
+    for (size_t i = 0; i < rows_; ++i) {
+        trace += buffer_[i * columns_ + i];
+    }
+    return trace;
+}
+
+template <class T>
+T Matrix<T>::Determinant() const {
+    CheckSquare();
+    Matrix<T> copy(*this);
+    return DeterminantInPlace(copy.buffer_, rows_);
+}
+
+template <class T>
+Matrix<T>& Matrix<T>::Inverse() {
+    CheckSquare();
+    std::vector<size_t> swaps(rows_);
+    if (!InvertInPlace(buffer_, swaps.data(), rows_)) {
+        throw MatrixArrayIsDegenerateError{};
+    }
+    return *this;
+}
+
+template <class T>
+Matrix<T> Matrix<T>::GetInversed() const& {
+    Matrix<T> copy(*this);
+    copy.Inverse();
+    return copy;
+}
+
+template <class T>
+Matrix<T> Matrix<T>::GetInversed() && {
+    Inverse();
+    return std::move(*this);
+}
+
+template <class T>
+Matrix<T>& Matrix<T>::ToUnit() {
+    for (size_t i = 0; i < rows_; ++i) {
+        for (size_t j = 0; j < columns_; ++j) {
+            buffer_[i * columns_ + j] = i == j ? kOne<T> : kZero<T>;
+        }
+    }
+    return *this;
+}
+
+// Product of any two views (of Matrix, MatrixArray or their blocks) through the blocked, row-parallel GEMM kernel.
+template <class T>
+Matrix<T> Multiply(const MatrixView<const T>& f, const MatrixView<const T>& s) {
+    if (f.columns_ != s.rows_) {
+        throw MatrixSizeMismatch{};
+    }
+    Matrix<T> mult(f.rows_, s.columns_);
+    Gemm(f.data_, f.stride_, s.data_, s.stride_, mult.Data(), s.columns_, f.rows_, f.columns_, s.columns_,
+         ComputeGemmTiles<T>(f.rows_, f.columns_, s.columns_));
+    return mult;
+}
+
+template <size_t N, size_t M, class T>
+MatrixArray<T, N, M> ToMatrixArray(const MatrixView<const T>& view) {
+    if (view.rows_ != N || view.columns_ != M) {
+        throw MatrixSizeMismatch{};
+    }
+    MatrixArray<T, N, M> m;
+    for (size_t i = 0; i < N; ++i) {
+        std::copy(view.data_ + i * view.stride_, view.data_ + i * view.stride_ + M, m.buffer_[i]);
+    }
+    return m;
+}
+
+template <class T>
+void CheckSameSize(const Matrix<T>& f, const Matrix<T>& s) {
+    if (f.RowsNumber() != s.RowsNumber() || f.ColumnsNumber() != s.ColumnsNumber()) {
+        throw MatrixSizeMismatch{};
+    }
+}
+
+template <class T>
+Matrix<T>& operator+=(Matrix<T>& f, const Matrix<T>& s) {
+    CheckSameSize(f, s);
+    SimdTransform<ElementwiseOp::kAdd>(f.Data(), s.Data(), f.Data(), f.Size());
+    return f;
+}
+
+template <class T>
+Matrix<T>& operator-=(Matrix<T>& f, const Matrix<T>& s) {
+    CheckSameSize(f, s);
+    SimdTransform<ElementwiseOp::kSubtract>(f.Data(), s.Data(), f.Data(), f.Size());
+    return f;
+}
+
+template <class T>
+Matrix<T> operator+(Matrix<T> f, const Matrix<T>& s) {
+    f += s;
+    return f;
+}
+
+template <class T>
+Matrix<T> operator-(Matrix<T> f, const Matrix<T>& s) {
+    f -= s;
+    return f;
+}
+
+template <class T>
+Matrix<T> operator*(const Matrix<T>& f, const Matrix<T>& s) {
+    return Multiply(f.GetView(), s.GetView());
+}
+
+template <class T>
+Matrix<T>& operator*=(Matrix<T>& f, const Matrix<T>& s) {
+    f = f * s;
+    return f;
+}
+
+template <class T>
+Matrix<T>& operator*=(Matrix<T>& f, const int32_t& digit) {
+    SimdTransformScalar<ElementwiseOp::kMultiply>(f.Data(), digit, f.Data(), f.Size());
+    return f;
+}
+
+template <class T>
+Matrix<T>& operator/=(Matrix<T>& f, const int32_t& digit) {
+    if (digit == 0) {
+        throw MatrixArrayDivisionByZero{};
+    }
+    SimdTransformScalar<ElementwiseOp::kDivide>(f.Data(), digit, f.Data(), f.Size());
+    return f;
+}
+
+template <class T>
+Matrix<T> operator*(Matrix<T> f, const int32_t& digit) {
+    f *= digit;
+    return f;
+}
+
+template <class T>
+Matrix<T> operator*(const int32_t& digit, Matrix<T> f) {
+    f *= digit;
+    return f;
+}
+
+template <class T>
+Matrix<T> operator/(Matrix<T> f, const int32_t& digit) {
+    f /= digit;
+    return f;
+}
+
+template <class T>
+std::istream& operator>>(std::istream& is, Matrix<T>& m) {
+    for (size_t i = 0; i < m.RowsNumber(); ++i) {
+        for (size_t j = 0; j < m.ColumnsNumber(); ++j) {
+            is >> m(i, j);
+        }
+    }
+    return is;
+}
+
+template <class T>
+std::ostream& operator<<(std::ostream& os, const Matrix<T>& m) {
+    for (size_t i = 0; i < m.RowsNumber(); ++i) {
+        for (size_t j = 0; j < m.ColumnsNumber(); ++j) {
+            os << m(i, j);
+            if (j + 1 != m.ColumnsNumber()) {
+                os << " ";
+            }
+        }
+        os << "\n";
+    }
+    return os;
+}
+
+template <class T>
+Matrix<T> SolveLinearSystem(const Matrix<T>& a, const Matrix<T>& b) {
+    if (a.RowsNumber() != a.ColumnsNumber() || a.RowsNumber() != b.RowsNumber()) {
+        throw MatrixSizeMismatch{};
+    }
+    Matrix<T> lu(a);
+    std::vector<size_t> permutation(a.RowsNumber());
+    bool odd = false;
+    if (!LuFactorize(lu.Data(), permutation.data(), a.RowsNumber(), odd)) {
+        throw MatrixArrayIsDegenerateError{};
+    }
+    Matrix<T> x(b.RowsNumber(), b.ColumnsNumber());
+    LuSolve(lu.Data(), permutation.data(), a.RowsNumber(), b.Data(), x.Data(), b.ColumnsNumber());
+    return x;
+}
+
+#endif  // MATRIX_ARRAY_MATRIX_H
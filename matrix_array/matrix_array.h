@@ -3,8 +3,16 @@
 #define MATRIX_ARRAY_SQUARE_MATRIX_IMPLEMENTED
 
 #include <util/constants.h>
+#include <elimination.h>
+#include <gemm.h>
+#include <matrix_expression.h>
+#include <simd_kernels.h>
+#include <algorithm>
+#include <cstring>
 #include <iomanip>
 #include <exception>
+#include <type_traits>
+#include <utility>
 
 class MatrixArrayDivisionByZero : public std::runtime_error {
 public:
@@ -18,6 +26,12 @@ public:
     }
 };
 
+class MatrixArrayIsNotPositiveDefiniteError : public std::runtime_error {
+public:
+    MatrixArrayIsNotPositiveDefiniteError() : std::runtime_error("MatrixArrayIsNotPositiveDefiniteError") {
+    }
+};
+
 class MatrixArrayOutOfRange : public std::out_of_range {
 public:
     MatrixArrayOutOfRange() : std::out_of_range("MatrixArrayOutOfRange") {
@@ -39,23 +53,50 @@ struct MatrixArray {
     MatrixArray<T, M, N>& Transpose();
     T Trace() const;
     T Determinant() const;
-    T MyDeterminant(size_t);
     MatrixArray<T, N, M>& ElemTran(
         const size_t&, const size_t&,
         T);  // add to the i-th column of the matrix A its j-th column, multiplied by the number λ
     MatrixArray<T, N, M>& Inverse();
-    MatrixArray<T, N, M> GetInversed() const;
+    MatrixArray<T, N, M> GetInversed() const&;
+    MatrixArray<T, N, M> GetInversed() &&;
     MatrixArray<T, N, M>& ToUnit();
     MatrixArray<T, N, M>& Copy(const MatrixArray<T, N, M>&);
-    MatrixArray<T, N, M> MatrixWithoutRowAndCol(const size_t&, const size_t&, const size_t&);
+    MatrixArray<T, N, M>& Copy(MatrixArray<T, N, M>&&);
+    template <MatrixExpressionNode E>
+    MatrixArray<T, N, M>& operator=(const E&);
 };
 
+template <class T, size_t N, size_t M>
+template <MatrixExpressionNode E>
+MatrixArray<T, N, M>& MatrixArray<T, N, M>::operator=(const E& e) {
+    static_assert(E::kRows == N && E::kColumns == M, "MatrixSizeMismatch");
+    AssignExpression(*this, e);
+    return *this;
+}
+
+// Trivially copyable elements are copied as one block of bytes, others are copied or moved one by one.
 template <class T, size_t N, size_t M>
 MatrixArray<T, N, M>& MatrixArray<T, N, M>::Copy(const MatrixArray<T, N, M>& m) {
-    for (size_t i = 0; i < N; ++i) {
-        for (size_t j = 0; j < M; ++j) {
-            buffer_[i][j] = m.buffer_[i][j];
-        }
+    if (this == &m) {
+        return *this;
+    }
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        std::memcpy(buffer_, m.buffer_, sizeof(buffer_));
+    } else {
+        std::copy(&m.buffer_[0][0], &m.buffer_[0][0] + N * M, &buffer_[0][0]);
+    }
+    return *this;
+}
+
+template <class T, size_t N, size_t M>
+MatrixArray<T, N, M>& MatrixArray<T, N, M>::Copy(MatrixArray<T, N, M>&& m) {
+    if (this == &m) {
+        return *this;
+    }
+    if constexpr (std::is_trivially_copyable_v<T>) {
+        std::memcpy(buffer_, m.buffer_, sizeof(buffer_));
+    } else {
+        std::move(&m.buffer_[0][0], &m.buffer_[0][0] + N * M, &buffer_[0][0]);
     }
     return *this;
 }
@@ -105,120 +146,91 @@ T& MatrixArray<T, N, M>::At(const size_t& row, const size_t& column) {
 template <class T, size_t N, size_t M>
 MatrixArray<T, M, N> MatrixArray<T, N, M>::GetTransposed() const {
     MatrixArray<T, M, N> transposed;
-    for (size_t i = 0; i < N; ++i) {
-        for (size_t j = 0; j < M; ++j) {
-            transposed.buffer_[j][i] = buffer_[i][j];
-        }
-    }
+    ParallelTranspose(&buffer_[0][0], N, M, &transposed.buffer_[0][0]);
     return transposed;
 }
 
-template <class T, size_t N, size_t M>
-MatrixArray<T, N, M> operator+(const MatrixArray<T, N, M>& f, const MatrixArray<T, N, M>& s) {
-    MatrixArray<T, N, M> sum;
-    for (size_t i = 0; i < N; ++i) {
-        for (size_t j = 0; j < M; ++j) {
-            sum.buffer_[i][j] = f.buffer_[i][j] + s.buffer_[i][j];
-        }
+template <class L, class R>
+requires SameShapeOperands<L, R>
+ElementwiseExpression<ElementwiseOp::kAdd, L, R> operator+(const L& f, const R& s) {
+    return {f, s};
+}
+
+template <class L, class R>
+requires SameShapeOperands<L, R>
+ElementwiseExpression<ElementwiseOp::kSubtract, L, R> operator-(const L& f, const R& s) {
+    return {f, s};
+}
+
+template <MatrixOperand E>
+ScalarExpression<ElementwiseOp::kMultiply, E> operator*(const E& f, const int32_t& digit) {
+    return {f, digit};
+}
+
+template <MatrixOperand E>
+ScalarExpression<ElementwiseOp::kMultiply, E> operator*(const int32_t& digit, const E& f) {
+    return {f, digit};
+}
+
+template <MatrixOperand E>
+ScalarExpression<ElementwiseOp::kDivide, E> operator/(const E& f, const int32_t& digit) {
+    if (digit == 0) {
+        throw MatrixArrayDivisionByZero{};
     }
-    return sum;
+    return {f, digit};
+}
+
+template <MatrixOperand E>
+TransposedExpression<E> Transposed(const E& f) {
+    return TransposedExpression<E>(f);
 }
 
 template <class T, size_t N, size_t M, size_t K>
 MatrixArray<T, N, K> operator*(const MatrixArray<T, N, M>& f, const MatrixArray<T, M, K>& s) {
+    constexpr GemmTiles kTiles = ComputeGemmTiles<T>(N, M, K);
     MatrixArray<T, N, K> mult;
-    T cell = 0;
-    for (size_t i = 0; i < N; ++i) {
-        for (size_t l = 0; l < K; ++l) {
-            cell = 0;
-            for (size_t j = 0; j < M; ++j) {
-                cell += f.buffer_[i][j] * s.buffer_[j][l];
-            }
-            mult.buffer_[i][l] = cell;
-        }
-    }
+    Gemm(&f.buffer_[0][0], M, &s.buffer_[0][0], K, &mult.buffer_[0][0], K, N, M, K, kTiles);
     return mult;
 }
 
-template <class T, size_t N, size_t M>
-MatrixArray<T, N, M>& operator+=(MatrixArray<T, N, M>& f, const MatrixArray<T, N, M>& s) {
-    for (size_t i = 0; i < N; ++i) {
-        for (size_t j = 0; j < M; ++j) {
-            f.buffer_[i][j] += s.buffer_[i][j];
-        }
-    }
+template <class T, size_t N, size_t M, class E>
+requires SameShapeOperands<MatrixArray<T, N, M>, E>
+MatrixArray<T, N, M>& operator+=(MatrixArray<T, N, M>& f, const E& s) {
+    ApplyExpression<ElementwiseOp::kAdd>(f, s);
     return f;
 }
 
-template <class T, size_t N, size_t M>
-MatrixArray<T, N, M>& operator-=(MatrixArray<T, N, M>& f, const MatrixArray<T, N, M>& s) {
-    for (size_t i = 0; i < N; ++i) {
-        for (size_t j = 0; j < M; ++j) {
-            f.buffer_[i][j] -= s.buffer_[i][j];
-        }
-    }
+template <class T, size_t N, size_t M, class E>
+requires SameShapeOperands<MatrixArray<T, N, M>, E>
+MatrixArray<T, N, M>& operator-=(MatrixArray<T, N, M>& f, const E& s) {
+    ApplyExpression<ElementwiseOp::kSubtract>(f, s);
     return f;
 }
 
 template <class T, size_t N, size_t M>
 MatrixArray<T, N, M>& operator*=(MatrixArray<T, N, M>& f, const MatrixArray<T, M, M>& s) {
+    constexpr GemmTiles kTiles = ComputeGemmTiles<T>(N, M, M);
     MatrixArray<T, N, M> mult;
-    T cell = 0;
-    for (size_t i = 0; i < N; ++i) {
-        for (size_t l = 0; l < M; ++l) {
-            cell = 0;
-            for (size_t j = 0; j < M; ++j) {
-                cell += f.buffer_[i][j] * s.buffer_[j][l];
-            }
-            mult.buffer_[i][l] = cell;
-        }
-    }
-    f.Copy(mult);
+    Gemm(&f.buffer_[0][0], M, &s.buffer_[0][0], M, &mult.buffer_[0][0], M, N, M, M, kTiles);
+    f.Copy(std::move(mult));
     return f;
 }
 
-template <class T, size_t N, size_t M>
-MatrixArray<T, N, M> operator*(const MatrixArray<T, N, M>& f, const int32_t& digit) {
-    MatrixArray<T, N, M> mult;
-    for (size_t i = 0; i < N; ++i) {
-        for (size_t j = 0; j < M; ++j) {
-            mult.buffer_[i][j] = f.buffer_[i][j] * digit;
-        }
-    }
-    return mult;
-}
-
-template <class T, size_t N, size_t M>
-MatrixArray<T, N, M> operator-(const MatrixArray<T, N, M>& f, const MatrixArray<T, N, M>& s) {
-    return f + (s * -1);
+// Products are not fused: expression operands are evaluated first and the blocked kernel runs on real storage.
+template <MatrixOperand L, MatrixOperand R>
+requires(MatrixExpressionNode<L> || MatrixExpressionNode<R>)
+auto operator*(const L& f, const R& s) {
+    return Materialize(f) * Materialize(s);
 }
 
-template <class T, size_t N, size_t M>
-MatrixArray<T, N, M> operator*(const int32_t& digit, const MatrixArray<T, N, M>& f) {
-    return f * digit;
-}
-
-template <class T, size_t N, size_t M>
-MatrixArray<T, N, M> operator/(const MatrixArray<T, N, M>& f, const int32_t& digit) {
-    if (digit == 0) {
-        throw MatrixArrayDivisionByZero{};
-    }
-    MatrixArray<T, N, M> div;
-    for (size_t i = 0; i < N; ++i) {
-        for (size_t j = 0; j < M; ++j) {
-            div.buffer_[i][j] = f.buffer_[i][j] / digit;
-        }
-    }
-    return div;
+template <class T, size_t N, size_t M, MatrixExpressionNode E>
+MatrixArray<T, N, M>& operator*=(MatrixArray<T, N, M>& f, const E& s) {
+    return f *= s.Evaluate();
 }
 
 template <class T, size_t N, size_t M>
 MatrixArray<T, N, M>& operator*=(MatrixArray<T, N, M>& f, const int32_t& digit) {
-    for (size_t i = 0; i < N; ++i) {
-        for (size_t j = 0; j < M; ++j) {
-            f.buffer_[i][j] *= digit;
-        }
-    }
+    SimdTransformScalar<ElementwiseOp::kMultiply>(&f.buffer_[0][0], digit, &f.buffer_[0][0], N * M);
     return f;
 }
 
@@ -227,13 +239,7 @@ MatrixArray<T, N, M>& operator/=(MatrixArray<T, N, M>& f, const int32_t& digit)
     if (digit == 0) {
         throw MatrixArrayDivisionByZero{};
     }
-    MatrixArray<T, N, M> div;
-    for (size_t i = 0; i < N; ++i) {
-        for (size_t j = 0; j < M; ++j) {
-            div.buffer_[i][j] = f.buffer_[i][j] / digit;
-        }
-    }
-    f.Copy(div);
+    SimdTransformScalar<ElementwiseOp::kDivide>(&f.buffer_[0][0], digit, &f.buffer_[0][0], N * M);
     return f;
 }
 
@@ -296,19 +302,15 @@ MatrixArray<T, N, M>& MatrixArray<T, N, M>::ToUnit() {
 
 template <class T>
 void Swap(T& f, T& s) {
-    T tmp = f;
-    f = s;
-    s = tmp;
+    T tmp = std::move(f);
+    f = std::move(s);
+    s = std::move(tmp);
 }
 
 template <class T, size_t N, size_t M>
 MatrixArray<T, M, N>& MatrixArray<T, N, M>::Transpose() {
     static_assert(N == M, "NotSquareMatrix");
-    for (size_t i = 0; i < N; ++i) {
-        for (size_t j = i; j < N; ++j) {
-            Swap(buffer_[i][j], buffer_[j][i]);
-        }
-    }
+    ParallelTransposeInPlace(&buffer_[0][0], N);
     return *this;
 }
 
@@ -325,126 +327,176 @@ T MatrixArray<T, N, M>::Trace() const {
 template <class T, size_t N, size_t M>
 MatrixArray<T, N, M>& MatrixArray<T, N, M>::ElemTran(const size_t& r, const size_t& c, T v) {
     static_assert(N == M, "NotSquareMatrix");
-    MatrixArray<T, N, M> unit;
-    unit.ToUnit();
-    unit.buffer_[r][c] = v;
-    *this *= unit;
-    return *this;
-}
-
-template <class T, size_t N, size_t M>
-MatrixArray<T, N, M> MatrixArray<T, N, M>::MatrixWithoutRowAndCol(const size_t& row, const size_t& col,
-                                                                  const size_t& n) {
-    size_t d = 0;
-    size_t k = 0;
-    MatrixArray<T, N, M> copy;
-    copy.Copy(*this);
-    for (size_t i = 0; i < n; ++i) {
-        if (i == row) {
-            d = 1;
-        }
-        k = 0;
-        for (size_t j = 0; j < n; ++j) {
-            if (j == col) {
-                k = 1;
-            }
-            copy.buffer_[i][j] = copy.buffer_[i + d][j + k];
+    for (size_t i = 0; i < N; ++i) {
+        if (r == c) {
+            buffer_[i][c] *= v;
+        } else {
+            buffer_[i][c] += buffer_[i][r] * v;
         }
     }
-    return copy;
+    return *this;
 }
 
 template <class T, size_t N, size_t M>
 T MatrixArray<T, N, M>::Determinant() const {
     static_assert(N == M, "NotSquareMatrix");
-    MatrixArray<T, N, M> copy;
-    copy.Copy(*this);
-    return copy.MyDeterminant(N);
+    MatrixArray<T, N, M> copy(*this);
+    return DeterminantInPlace(&copy.buffer_[0][0], N);
 }
 
 template <class T, size_t N, size_t M>
-T MatrixArray<T, N, M>::MyDeterminant(size_t n) {
-    T zero = kZero<T>;
-    T one = kOne<T>;
-    T determinant = zero;
-    T degree = one;
-    if (n == 1) {
-        return buffer_[0][0];
+MatrixArray<T, N, M>& MatrixArray<T, N, M>::Inverse() {
+    static_assert(N == M, "NotSquareMatrix");
+    size_t swaps[N];
+    if (!InvertInPlace(&buffer_[0][0], swaps, N)) {
+        throw MatrixArrayIsDegenerateError{};
     }
-    if (n == 2) {
-        return buffer_[0][0] * buffer_[n - 1][n - 1] - buffer_[0][n - 1] * buffer_[n - 1][0];
+    return *this;
+}
+
+template <class T, size_t N, size_t M>
+MatrixArray<T, N, M> MatrixArray<T, N, M>::GetInversed() const& {
+    MatrixArray<T, N, M> copy(*this);
+    copy.Inverse();
+    return copy;
+}
+
+// A temporary is inverted in place and moved out instead of being copied first.
+template <class T, size_t N, size_t M>
+MatrixArray<T, N, M> MatrixArray<T, N, M>::GetInversed() && {
+    Inverse();
+    return std::move(*this);
+}
+
+// PA = LU factorization of a square matrix, computed once and reused for determinants, inverses and systems with any
+// number of right-hand sides.
+template <class T, size_t N>
+class LuDecomposition {
+public:
+    explicit LuDecomposition(MatrixArray<T, N, N>);
+    T Determinant() const;
+    template <size_t K>
+    MatrixArray<T, N, K> Solve(const MatrixArray<T, N, K>&) const;
+    MatrixArray<T, N, N> GetInversed() const;
+
+private:
+    MatrixArray<T, N, N> lu_;
+    size_t permutation_[N];
+    bool odd_;
+};
+
+template <class T, size_t N>
+LuDecomposition<T, N>::LuDecomposition(MatrixArray<T, N, N> a) : lu_(std::move(a)) {
+    if (!LuFactorize(&lu_.buffer_[0][0], permutation_, N, odd_)) {
+        throw MatrixArrayIsDegenerateError{};
     }
-    for (size_t j = 0; j < n; ++j) {
-        determinant += degree * buffer_[0][j] * MatrixWithoutRowAndCol(0, j, n - 1).MyDeterminant(n - 1);
-        degree = -degree;
+}
+
+template <class T, size_t N>
+T LuDecomposition<T, N>::Determinant() const {
+    T determinant = kOne<T>;
+    for (size_t i = 0; i < N; ++i) {
+        determinant *= lu_.buffer_[i][i];
     }
-    return determinant;
+    return odd_ ? kZero<T> - determinant : determinant;
 }
 
-template <class T, size_t N, size_t M>
-MatrixArray<T, N, M>& MatrixArray<T, N, M>::Inverse() {
-    static_assert(N == M, "NotSquareMatrix");
-    T zero = kZero<T>;
-    T one = kOne<T>;
-    MatrixArray<T, N, M> unit;
+template <class T, size_t N>
+template <size_t K>
+MatrixArray<T, N, K> LuDecomposition<T, N>::Solve(const MatrixArray<T, N, K>& b) const {
+    MatrixArray<T, N, K> x;
+    LuSolve(&lu_.buffer_[0][0], permutation_, N, &b.buffer_[0][0], &x.buffer_[0][0], K);
+    return x;
+}
+
+template <class T, size_t N>
+MatrixArray<T, N, N> LuDecomposition<T, N>::GetInversed() const {
+    MatrixArray<T, N, N> unit;
     unit.ToUnit();
-    for (size_t i = 0; i < N; i++) {
-        for (size_t j = i; j < N; j++) {
-            if (buffer_[i][j] != zero) {
-                T div = (one / buffer_[i][j]);
-                ElemTran(j, j, div);
-                unit.ElemTran(j, j, div);
-                for (size_t k = j + 1; k < N; k++) {
-                    if (buffer_[i][k] != zero) {
-                        div = -(buffer_[i][k] / buffer_[i][j]);
-                        ElemTran(j, k, div);
-                        unit.ElemTran(j, k, div);
-                    }
-                }
-                for (size_t h = 0; h < N; ++h) {
-                    Swap(buffer_[h][i], buffer_[h][j]);
-                    Swap(unit.buffer_[h][i], unit.buffer_[h][j]);
-                }
-                break;
-            }
-        }
+    return Solve(unit);
+}
+
+// A = L L^T factorization of a symmetric positive definite matrix of a floating point type; about half the work of
+// LuDecomposition. Only the lower triangle of the matrix is read.
+template <class T, size_t N>
+class CholeskyDecomposition {
+    static_assert(std::is_floating_point_v<T>, "NotFloatingPoint");
+
+public:
+    explicit CholeskyDecomposition(MatrixArray<T, N, N>);
+    T Determinant() const;
+    template <size_t K>
+    MatrixArray<T, N, K> Solve(const MatrixArray<T, N, K>&) const;
+
+private:
+    MatrixArray<T, N, N> l_;
+};
+
+template <class T, size_t N>
+CholeskyDecomposition<T, N>::CholeskyDecomposition(MatrixArray<T, N, N> a) : l_(std::move(a)) {
+    if (!CholeskyFactorize(&l_.buffer_[0][0], N)) {
+        throw MatrixArrayIsNotPositiveDefiniteError{};
     }
-    T determinant = one;
+}
+
+template <class T, size_t N>
+T CholeskyDecomposition<T, N>::Determinant() const {
+    T determinant = kOne<T>;
     for (size_t i = 0; i < N; ++i) {
-        determinant *= buffer_[i][i];
+        determinant *= l_.buffer_[i][i] * l_.buffer_[i][i];
     }
-    if (determinant == zero) {
+    return determinant;
+}
+
+template <class T, size_t N>
+template <size_t K>
+MatrixArray<T, N, K> CholeskyDecomposition<T, N>::Solve(const MatrixArray<T, N, K>& b) const {
+    MatrixArray<T, N, K> x;
+    CholeskySolve(&l_.buffer_[0][0], N, &b.buffer_[0][0], &x.buffer_[0][0], K);
+    return x;
+}
+
+// Householder A = QR factorization of a floating point N x M matrix with N >= M. Solve returns the least squares
+// solution, which is the exact one for a square matrix; it stays accurate for ill-conditioned systems where
+// LuDecomposition loses precision.
+template <class T, size_t N, size_t M>
+class QrDecomposition {
+    static_assert(std::is_floating_point_v<T>, "NotFloatingPoint");
+    static_assert(N >= M, "UnderdeterminedSystem");
+
+public:
+    explicit QrDecomposition(MatrixArray<T, N, M>);
+    template <size_t K>
+    MatrixArray<T, M, K> Solve(const MatrixArray<T, N, K>&) const;
+
+private:
+    MatrixArray<T, N, M> qr_;
+    T tau_[M];
+    T diagonal_[M];
+};
+
+template <class T, size_t N, size_t M>
+QrDecomposition<T, N, M>::QrDecomposition(MatrixArray<T, N, M> a) : qr_(std::move(a)) {
+    if (!HouseholderQr(&qr_.buffer_[0][0], tau_, diagonal_, N, M)) {
         throw MatrixArrayIsDegenerateError{};
     }
-    for (size_t i = 0; i < N; ++i) {
-        for (int32_t k = i - 1; k >= 0; --k) {
-            if (buffer_[i][k] != zero) {
-                T div = -(buffer_[i][k] / buffer_[i][i]);
-                ElemTran(i, k, div);
-                unit.ElemTran(i, k, div);
-            }
-        }
-    }
-    this->Copy(unit);
-    return *this;
 }
 
 template <class T, size_t N, size_t M>
-MatrixArray<T, N, M> MatrixArray<T, N, M>::GetInversed() const {
-    MatrixArray<T, N, M> copy;
-    copy.Copy(*this);
-    copy.Inverse();
-    return copy;
+template <size_t K>
+MatrixArray<T, M, K> QrDecomposition<T, N, M>::Solve(const MatrixArray<T, N, K>& b) const {
+    MatrixArray<T, N, K> rotated(b);
+    MatrixArray<T, M, K> x;
+    T dots[K];
+    QrSolve(&qr_.buffer_[0][0], tau_, diagonal_, N, M, &rotated.buffer_[0][0], &x.buffer_[0][0], K, dots);
+    return x;
 }
 
+// Solves A X = B for every column of B with one LU factorization of A; a degenerate A is detected while factorizing.
 template <class T, size_t N, size_t M, size_t K>
 MatrixArray<T, N, K> SolveLinearSystem(const MatrixArray<T, N, M>& a, const MatrixArray<T, N, K>& b) {
     static_assert(N == M, "NotSquareMatrix");
-    static_assert(K == 1, "NotColumns");
-    if (a.Determinant() == kZero<T>) {
-        throw MatrixArrayIsDegenerateError{};
-    }
-    return a.GetInversed() * b;
+    return LuDecomposition<T, N>(a).Solve(b);
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,653 @@
+#ifndef MATRIX_ARRAY_SPARSE_MATRIX_H
+#define MATRIX_ARRAY_SPARSE_MATRIX_H
+
+#include "matrix.h"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <exception>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+class SparseMatrixFormatError : public std::invalid_argument {
+public:
+    SparseMatrixFormatError() : std::invalid_argument("SparseMatrixFormatError") {
+    }
+};
+
+class SparseSolverNotConvergedError : public std::runtime_error {
+public:
+    SparseSolverNotConvergedError() : std::runtime_error("SparseSolverNotConvergedError") {
+    }
+};
+
+struct SparseSolverOptions {
+    double tolerance_ = 1e-10;   // stop once |r| <= tolerance_ * |b| for every right-hand side
+    size_t max_iterations_ = 0;  // 10 * rows if zero
+};
+
+// Compressed storage shared by CSR and CSC: outer_ lines (rows or columns) of inner_ elements each. The non-zeros of
+// line i are values_[offsets_[i]..offsets_[i + 1]) at the strictly increasing positions indices_[...] within the
+// line. The same storage read the other way round is the transposed matrix.
+template <class T>
+struct CompressedStorage {
+    size_t outer_ = 0;
+    size_t inner_ = 0;
+    std::vector<size_t> offsets_ = {0};
+    std::vector<size_t> indices_;
+    std::vector<T> values_;
+};
+
+namespace sparse_detail {
+
+template <class T>
+void Validate(const CompressedStorage<T>& s) {
+    if (s.offsets_.size() != s.outer_ + 1 || s.offsets_.front() != 0 || s.offsets_.back() != s.indices_.size() ||
+        s.indices_.size() != s.values_.size()) {
+        throw SparseMatrixFormatError{};
+    }
+    for (size_t i = 0; i < s.outer_; ++i) {
+        if (s.offsets_[i] > s.offsets_[i + 1]) {
+            throw SparseMatrixFormatError{};
+        }
+        for (size_t p = s.offsets_[i]; p < s.offsets_[i + 1]; ++p) {
+            if (s.indices_[p] >= s.inner_ || (p > s.offsets_[i] && s.indices_[p] <= s.indices_[p - 1])) {
+                throw SparseMatrixFormatError{};
+            }
+        }
+    }
+}
+
+// Non-zeros of a dense view, line by line along rows (by_rows) or columns.
+template <class T>
+CompressedStorage<T> Compress(const MatrixView<const T>& view, const bool& by_rows) {
+    CompressedStorage<T> s;
+    s.outer_ = by_rows ? view.rows_ : view.columns_;
+    s.inner_ = by_rows ? view.columns_ : view.rows_;
+    s.offsets_.reserve(s.outer_ + 1);
+    for (size_t i = 0; i < s.outer_; ++i) {
+        for (size_t j = 0; j < s.inner_; ++j) {
+            const T& value = by_rows ? view(i, j) : view(j, i);
+            if (value != kZero<T>) {
+                s.indices_.push_back(j);
+                s.values_.push_back(value);
+            }
+        }
+        s.offsets_.push_back(s.indices_.size());
+    }
+    return s;
+}
+
+// The same matrix compressed along the other dimension, by a counting sort on the inner indices.
+template <class T>
+CompressedStorage<T> Transpose(const CompressedStorage<T>& s) {
+    CompressedStorage<T> t;
+    t.outer_ = s.inner_;
+    t.inner_ = s.outer_;
+    t.offsets_.assign(t.outer_ + 1, 0);
+    for (const auto& index : s.indices_) {
+        ++t.offsets_[index + 1];
+    }
+    for (size_t i = 0; i < t.outer_; ++i) {
+        t.offsets_[i + 1] += t.offsets_[i];
+    }
+    t.indices_.resize(s.indices_.size());
+    t.values_.resize(s.values_.size());
+    std::vector<size_t> next(t.offsets_.begin(), t.offsets_.end() - 1);
+    for (size_t i = 0; i < s.outer_; ++i) {
+        for (size_t p = s.offsets_[i]; p < s.offsets_[i + 1]; ++p) {
+            size_t q = next[s.indices_[p]]++;
+            t.indices_[q] = i;
+            t.values_[q] = s.values_[p];
+        }
+    }
+    return t;
+}
+
+template <class T>
+T Find(const CompressedStorage<T>& s, const size_t& outer, const size_t& inner) {
+    auto first = s.indices_.begin() + s.offsets_[outer];
+    auto last = s.indices_.begin() + s.offsets_[outer + 1];
+    auto it = std::lower_bound(first, last, inner);
+    return it != last && *it == inner ? s.values_[it - s.indices_.begin()] : kZero<T>;
+}
+
+// Line by line product of f[n x m] and s[m x k] both compressed along rows (Gustavson): line i of the result
+// accumulates the lines of s picked by the non-zeros of line i of f in a dense row, touched positions are collected
+// and sorted.
+template <class T>
+CompressedStorage<T> Product(const CompressedStorage<T>& f, const CompressedStorage<T>& s) {
+    if (f.inner_ != s.outer_) {
+        throw MatrixSizeMismatch{};
+    }
+    CompressedStorage<T> r;
+    r.outer_ = f.outer_;
+    r.inner_ = s.inner_;
+    r.offsets_.reserve(r.outer_ + 1);
+    std::vector<T> accumulator(r.inner_, kZero<T>);
+    std::vector<size_t> marker(r.inner_, r.outer_);
+    std::vector<size_t> touched;
+    for (size_t i = 0; i < f.outer_; ++i) {
+        touched.clear();
+        for (size_t p = f.offsets_[i]; p < f.offsets_[i + 1]; ++p) {
+            size_t row = f.indices_[p];
+            for (size_t q = s.offsets_[row]; q < s.offsets_[row + 1]; ++q) {
+                size_t j = s.indices_[q];
+                if (marker[j] != i) {
+                    marker[j] = i;
+                    accumulator[j] = kZero<T>;
+                    touched.push_back(j);
+                }
+                accumulator[j] += f.values_[p] * s.values_[q];
+            }
+        }
+        std::sort(touched.begin(), touched.end());
+        for (const auto& j : touched) {
+            r.indices_.push_back(j);
+            r.values_.push_back(accumulator[j]);
+        }
+        r.offsets_.push_back(r.indices_.size());
+    }
+    return r;
+}
+
+// out[outer x k] = s * x[inner x k] for s compressed along rows; rows of out are independent and run in parallel.
+template <class T>
+void MultiplyRows(const CompressedStorage<T>& s, const MatrixView<const T>& x, T* out) {
+    size_t k = x.columns_;
+    size_t row_cost = (s.indices_.size() / std::max<size_t>(1, s.outer_) + 1) * k;
+    ForEachRowBlock(0, s.outer_, row_cost, 1, [&](const size_t& first, const size_t& last) {
+        for (size_t i = first; i < last; ++i) {
+            T* row = out + i * k;
+            std::fill(row, row + k, kZero<T>);
+            for (size_t p = s.offsets_[i]; p < s.offsets_[i + 1]; ++p) {
+                const T* source = x.data_ + s.indices_[p] * x.stride_;
+                for (size_t j = 0; j < k; ++j) {
+                    row[j] += s.values_[p] * source[j];
+                }
+            }
+        }
+    });
+}
+
+// out[n x inner] = x[n x outer] * s for s compressed along rows; rows of x scatter lines of s into rows of out.
+template <class T>
+void MultiplyByRows(const MatrixView<const T>& x, const CompressedStorage<T>& s, T* out) {
+    size_t row_cost = s.indices_.size() + s.inner_;
+    ForEachRowBlock(0, x.rows_, row_cost, 1, [&](const size_t& first, const size_t& last) {
+        for (size_t i = first; i < last; ++i) {
+            T* row = out + i * s.inner_;
+            std::fill(row, row + s.inner_, kZero<T>);
+            for (size_t p = 0; p < s.outer_; ++p) {
+                T factor = x(i, p);
+                for (size_t q = s.offsets_[p]; q < s.offsets_[p + 1]; ++q) {
+                    row[s.indices_[q]] += factor * s.values_[q];
+                }
+            }
+        }
+    });
+}
+
+}  // namespace sparse_detail
+
+template <class T>
+class CscMatrix;
+
+// Compressed sparse row matrix: only non-zeros are stored, rows are contiguous. Products with dense matrices cost
+// O(non-zeros) per column of the dense operand.
+template <class T>
+class CsrMatrix {
+public:
+    CsrMatrix();
+    CsrMatrix(const size_t&, const size_t&);
+    CsrMatrix(const size_t&, const size_t&, std::vector<size_t>, std::vector<size_t>, std::vector<T>);
+    explicit CsrMatrix(CompressedStorage<T>);
+    explicit CsrMatrix(const MatrixView<const T>&);
+    template <size_t N, size_t M>
+    explicit CsrMatrix(const MatrixArray<T, N, M>&);
+    explicit CsrMatrix(const Matrix<T>&);
+    explicit CsrMatrix(const CscMatrix<T>&);
+    size_t RowsNumber() const;
+    size_t ColumnsNumber() const;
+    size_t NonZerosNumber() const;
+    const std::vector<size_t>& RowOffsets() const;
+    const std::vector<size_t>& ColumnIndices() const;
+    const std::vector<T>& Values() const;
+    const CompressedStorage<T>& Storage() const;
+    T At(const size_t&, const size_t&) const;
+    CsrMatrix<T> GetTransposed() const;
+    Matrix<T> ToMatrix() const;
+    template <size_t N, size_t M>
+    MatrixArray<T, N, M> ToMatrixArray() const;
+    void Multiply(const T*, T*) const;
+
+private:
+    CompressedStorage<T> storage_;
+};
+
+// Compressed sparse column matrix: columns are contiguous. Holds the same storage as the CSR form of the transposed
+// matrix, so conversions between the two formats are a single counting sort.
+template <class T>
+class CscMatrix {
+public:
+    CscMatrix();
+    CscMatrix(const size_t&, const size_t&);
+    CscMatrix(const size_t&, const size_t&, std::vector<size_t>, std::vector<size_t>, std::vector<T>);
+    explicit CscMatrix(CompressedStorage<T>);
+    explicit CscMatrix(const MatrixView<const T>&);
+    template <size_t N, size_t M>
+    explicit CscMatrix(const MatrixArray<T, N, M>&);
+    explicit CscMatrix(const Matrix<T>&);
+    explicit CscMatrix(const CsrMatrix<T>&);
+    size_t RowsNumber() const;
+    size_t ColumnsNumber() const;
+    size_t NonZerosNumber() const;
+    const std::vector<size_t>& ColumnOffsets() const;
+    const std::vector<size_t>& RowIndices() const;
+    const std::vector<T>& Values() const;
+    const CompressedStorage<T>& Storage() const;
+    T At(const size_t&, const size_t&) const;
+    CscMatrix<T> GetTransposed() const;
+    Matrix<T> ToMatrix() const;
+    template <size_t N, size_t M>
+    MatrixArray<T, N, M> ToMatrixArray() const;
+    void Multiply(const T*, T*) const;
+
+private:
+    CompressedStorage<T> storage_;
+};
+
+template <class T>
+CsrMatrix<T>::CsrMatrix() = default;
+
+template <class T>
+CsrMatrix<T>::CsrMatrix(const size_t& rows, const size_t& columns) {
+    storage_.outer_ = rows;
+    storage_.inner_ = columns;
+    storage_.offsets_.assign(rows + 1, 0);
+}
+
+template <class T>
+CsrMatrix<T>::CsrMatrix(const size_t& rows, const size_t& columns, std::vector<size_t> offsets,
+                        std::vector<size_t> indices, std::vector<T> values)
+    : CsrMatrix(CompressedStorage<T>{rows, columns, std::move(offsets), std::move(indices), std::move(values)}) {
+}
+
+template <class T>
+CsrMatrix<T>::CsrMatrix(CompressedStorage<T> storage) : storage_(std::move(storage)) {
+    sparse_detail::Validate(storage_);
+}
+
+template <class T>
+CsrMatrix<T>::CsrMatrix(const MatrixView<const T>& view) : storage_(sparse_detail::Compress(view, true)) {
+}
+
+template <class T>
+template <size_t N, size_t M>
+CsrMatrix<T>::CsrMatrix(const MatrixArray<T, N, M>& m) : CsrMatrix(MatrixView<const T>(m)) {
+}
+
+template <class T>
+CsrMatrix<T>::CsrMatrix(const Matrix<T>& m) : CsrMatrix(m.GetView()) {
+}
+
+template <class T>
+CsrMatrix<T>::CsrMatrix(const CscMatrix<T>& m) : storage_(sparse_detail::Transpose(m.Storage())) {
+}
+
+template <class T>
+size_t CsrMatrix<T>::RowsNumber() const {
+    return storage_.outer_;
+}
+
+template <class T>
+size_t CsrMatrix<T>::ColumnsNumber() const {
+    return storage_.inner_;
+}
+
+template <class T>
+size_t CsrMatrix<T>::NonZerosNumber() const {
+    return storage_.values_.size();
+}
+
+template <class T>
+const std::vector<size_t>& CsrMatrix<T>::RowOffsets() const {
+    return storage_.offsets_;
+}
+
+template <class T>
+const std::vector<size_t>& CsrMatrix<T>::ColumnIndices() const {
+    return storage_.indices_;
+}
+
+template <class T>
+const std::vector<T>& CsrMatrix<T>::Values() const {
+    return storage_.values_;
+}
+
+template <class T>
+const CompressedStorage<T>& CsrMatrix<T>::Storage() const {
+    return storage_;
+}
+
+template <class T>
+T CsrMatrix<T>::At(const size_t& row, const size_t& column) const {
+    if (row >= RowsNumber() || column >= ColumnsNumber()) {
+        throw MatrixArrayOutOfRange{};
+    }
+    return sparse_detail::Find(storage_, row, column);
+}
+
+template <class T>
+CsrMatrix<T> CsrMatrix<T>::GetTransposed() const {
+    return CsrMatrix<T>(sparse_detail::Transpose(storage_));
+}
+
+template <class T>
+Matrix<T> CsrMatrix<T>::ToMatrix() const {
+    Matrix<T> m(RowsNumber(), ColumnsNumber(), kZero<T>);
+    for (size_t i = 0; i < RowsNumber(); ++i) {
+        for (size_t p = storage_.offsets_[i]; p < storage_.offsets_[i + 1]; ++p) {
+            m(i, storage_.indices_[p]) = storage_.values_[p];
+        }
+    }
+    return m;
+}
+
+template <class T>
+template <size_t N, size_t M>
+MatrixArray<T, N, M> CsrMatrix<T>::ToMatrixArray() const {
+    const Matrix<T> m = ToMatrix();
+    return ::ToMatrixArray<N, M>(m.GetView());
+}
+
+// y = A x for vectors x of ColumnsNumber() and y of RowsNumber() elements.
+template <class T>
+void CsrMatrix<T>::Multiply(const T* x, T* y) const {
+    sparse_detail::MultiplyRows(storage_, MatrixView<const T>(x, ColumnsNumber(), 1, 1), y);
+}
+
+template <class T>
+CscMatrix<T>::CscMatrix() = default;
+
+template <class T>
+CscMatrix<T>::CscMatrix(const size_t& rows, const size_t& columns) {
+    storage_.outer_ = columns;
+    storage_.inner_ = rows;
+    storage_.offsets_.assign(columns + 1, 0);
+}
+
+template <class T>
+CscMatrix<T>::CscMatrix(const size_t& rows, const size_t& columns, std::vector<size_t> offsets,
+                        std::vector<size_t> indices, std::vector<T> values)
+    : CscMatrix(CompressedStorage<T>{columns, rows, std::move(offsets), std::move(indices), std::move(values)}) {
+}
+
+template <class T>
+CscMatrix<T>::CscMatrix(CompressedStorage<T> storage) : storage_(std::move(storage)) {
+    sparse_detail::Validate(storage_);
+}
+
+template <class T>
+CscMatrix<T>::CscMatrix(const MatrixView<const T>& view) : storage_(sparse_detail::Compress(view, false)) {
+}
+
+template <class T>
+template <size_t N, size_t M>
+CscMatrix<T>::CscMatrix(const MatrixArray<T, N, M>& m) : CscMatrix(MatrixView<const T>(m)) {
+}
+
+template <class T>
+CscMatrix<T>::CscMatrix(const Matrix<T>& m) : CscMatrix(m.GetView()) {
+}
+
+template <class T>
+CscMatrix<T>::CscMatrix(const CsrMatrix<T>& m) : storage_(sparse_detail::Transpose(m.Storage())) {
+}
+
+template <class T>
+size_t CscMatrix<T>::RowsNumber() const {
+    return storage_.inner_;
+}
+
+template <class T>
+size_t CscMatrix<T>::ColumnsNumber() const {
+    return storage_.outer_;
+}
+
+template <class T>
+size_t CscMatrix<T>::NonZerosNumber() const {
+    return storage_.values_.size();
+}
+
+template <class T>
+const std::vector<size_t>& CscMatrix<T>::ColumnOffsets() const {
+    return storage_.offsets_;
+}
+
+template <class T>
+const std::vector<size_t>& CscMatrix<T>::RowIndices() const {
+    return storage_.indices_;
+}
+
+template <class T>
+const std::vector<T>& CscMatrix<T>::Values() const {
+    return storage_.values_;
+}
+
+template <class T>
+const CompressedStorage<T>& CscMatrix<T>::Storage() const {
+    return storage_;
+}
+
+template <class T>
+T CscMatrix<T>::At(const size_t& row, const size_t& column) const {
+    if (row >= RowsNumber() || column >= ColumnsNumber()) {
+        throw MatrixArrayOutOfRange{};
+    }
+    return sparse_detail::Find(storage_, column, row);
+}
+
+template <class T>
+CscMatrix<T> CscMatrix<T>::GetTransposed() const {
+    return CscMatrix<T>(sparse_detail::Transpose(storage_));
+}
+
+template <class T>
+Matrix<T> CscMatrix<T>::ToMatrix() const {
+    Matrix<T> m(RowsNumber(), ColumnsNumber(), kZero<T>);
+    for (size_t j = 0; j < ColumnsNumber(); ++j) {
+        for (size_t p = storage_.offsets_[j]; p < storage_.offsets_[j + 1]; ++p) {
+            m(storage_.indices_[p], j) = storage_.values_[p];
+        }
+    }
+    return m;
+}
+
+template <class T>
+template <size_t N, size_t M>
+MatrixArray<T, N, M> CscMatrix<T>::ToMatrixArray() const {
+    const Matrix<T> m = ToMatrix();
+    return ::ToMatrixArray<N, M>(m.GetView());
+}
+
+// y = A x; columns of A are scattered into y, so this runs on one thread.
+template <class T>
+void CscMatrix<T>::Multiply(const T* x, T* y) const {
+    std::fill(y, y + RowsNumber(), kZero<T>);
+    for (size_t j = 0; j < ColumnsNumber(); ++j) {
+        for (size_t p = storage_.offsets_[j]; p < storage_.offsets_[j + 1]; ++p) {
+            y[storage_.indices_[p]] += storage_.values_[p] * x[j];
+        }
+    }
+}
+
+template <class T>
+Matrix<T> Multiply(const CsrMatrix<T>& f, const MatrixView<const T>& s) {
+    if (f.ColumnsNumber() != s.rows_) {
+        throw MatrixSizeMismatch{};
+    }
+    Matrix<T> mult(f.RowsNumber(), s.columns_);
+    sparse_detail::MultiplyRows(f.Storage(), s, mult.Data());
+    return mult;
+}
+
+template <class T>
+Matrix<T> Multiply(const MatrixView<const T>& f, const CsrMatrix<T>& s) {
+    if (f.columns_ != s.RowsNumber()) {
+        throw MatrixSizeMismatch{};
+    }
+    Matrix<T> mult(f.rows_, s.ColumnsNumber());
+    sparse_detail::MultiplyByRows(f, s.Storage(), mult.Data());
+    return mult;
+}
+
+// Column j of f scatters row j of s into the rows of the product, so this runs on one thread.
+template <class T>
+Matrix<T> Multiply(const CscMatrix<T>& f, const MatrixView<const T>& s) {
+    if (f.ColumnsNumber() != s.rows_) {
+        throw MatrixSizeMismatch{};
+    }
+    const auto& storage = f.Storage();
+    Matrix<T> mult(f.RowsNumber(), s.columns_, kZero<T>);
+    for (size_t j = 0; j < storage.outer_; ++j) {
+        const T* source = s.data_ + j * s.stride_;
+        for (size_t p = storage.offsets_[j]; p < storage.offsets_[j + 1]; ++p) {
+            T* row = mult.Data() + storage.indices_[p] * s.columns_;
+            for (size_t k = 0; k < s.columns_; ++k) {
+                row[k] += storage.values_[p] * source[k];
+            }
+        }
+    }
+    return mult;
+}
+
+template <class T>
+Matrix<T> Multiply(const MatrixView<const T>& f, const CscMatrix<T>& s) {
+    if (f.columns_ != s.RowsNumber()) {
+        throw MatrixSizeMismatch{};
+    }
+    const auto& storage = s.Storage();
+    Matrix<T> mult(f.rows_, s.ColumnsNumber());
+    ForEachRowBlock(0, f.rows_, storage.indices_.size() + 1, 1, [&](const size_t& first, const size_t& last) {
+        for (size_t i = first; i < last; ++i) {
+            for (size_t j = 0; j < storage.outer_; ++j) {
+                T dot = kZero<T>;
+                for (size_t p = storage.offsets_[j]; p < storage.offsets_[j + 1]; ++p) {
+                    dot += f(i, storage.indices_[p]) * storage.values_[p];
+                }
+                mult(i, j) = dot;
+            }
+        }
+    });
+    return mult;
+}
+
+template <class T>
+Matrix<T> operator*(const CsrMatrix<T>& f, const Matrix<T>& s) {
+    return Multiply(f, s.GetView());
+}
+
+template <class T>
+Matrix<T> operator*(const Matrix<T>& f, const CsrMatrix<T>& s) {
+    return Multiply(f.GetView(), s);
+}
+
+template <class T>
+Matrix<T> operator*(const CscMatrix<T>& f, const Matrix<T>& s) {
+    return Multiply(f, s.GetView());
+}
+
+template <class T>
+Matrix<T> operator*(const Matrix<T>& f, const CscMatrix<T>& s) {
+    return Multiply(f.GetView(), s);
+}
+
+template <class T>
+CsrMatrix<T> operator*(const CsrMatrix<T>& f, const CsrMatrix<T>& s) {
+    return CsrMatrix<T>(sparse_detail::Product(f.Storage(), s.Storage()));
+}
+
+// (A B)^T = B^T A^T, and the CSC storages of A and B are the CSR storages of A^T and B^T.
+template <class T>
+CscMatrix<T> operator*(const CscMatrix<T>& f, const CscMatrix<T>& s) {
+    return CscMatrix<T>(sparse_detail::Product(s.Storage(), f.Storage()));
+}
+
+// Jacobi-preconditioned conjugate gradients for a symmetric positive definite sparse a, one right-hand side (column
+// of b) at a time. Throws MatrixArrayIsNotPositiveDefiniteError when a breaks down on a non-positive curvature or
+// diagonal, SparseSolverNotConvergedError when the residual is still too large after options.max_iterations_.
+template <class T>
+Matrix<T> SolveLinearSystem(const CsrMatrix<T>& a, const Matrix<T>& b, const SparseSolverOptions& options = {}) {
+    static_assert(std::is_floating_point_v<T>, "NotFloatingPoint");
+    size_t n = a.RowsNumber();
+    if (a.ColumnsNumber() != n || b.RowsNumber() != n) {
+        throw MatrixSizeMismatch{};
+    }
+    std::vector<T> inverse_diagonal(n);
+    for (size_t i = 0; i < n; ++i) {
+        T diagonal = a.At(i, i);
+        if (!(diagonal > kZero<T>)) {
+            throw MatrixArrayIsNotPositiveDefiniteError{};
+        }
+        inverse_diagonal[i] = kOne<T> / diagonal;
+    }
+    size_t max_iterations = options.max_iterations_ ? options.max_iterations_ : 10 * n;
+    Matrix<T> x(n, b.ColumnsNumber(), kZero<T>);
+    std::vector<T> solution(n);
+    std::vector<T> residual(n);
+    std::vector<T> preconditioned(n);
+    std::vector<T> direction(n);
+    std::vector<T> product(n);
+    auto dot = [n](const std::vector<T>& f, const std::vector<T>& s) {
+        T sum = kZero<T>;
+        for (size_t i = 0; i < n; ++i) {
+            sum += f[i] * s[i];
+        }
+        return sum;
+    };
+    for (size_t column = 0; column < b.ColumnsNumber(); ++column) {
+        std::fill(solution.begin(), solution.end(), kZero<T>);
+        for (size_t i = 0; i < n; ++i) {
+            residual[i] = b(i, column);
+            preconditioned[i] = residual[i] * inverse_diagonal[i];
+        }
+        T bound = static_cast<T>(options.tolerance_) * std::sqrt(dot(residual, residual));
+        direction = preconditioned;
+        T rho = dot(residual, preconditioned);
+        size_t iteration = 0;
+        while (std::sqrt(dot(residual, residual)) > bound) {
+            if (iteration++ == max_iterations) {
+                throw SparseSolverNotConvergedError{};
+            }
+            a.Multiply(direction.data(), product.data());
+            T curvature = dot(direction, product);
+            if (!(curvature > kZero<T>)) {
+                throw MatrixArrayIsNotPositiveDefiniteError{};
+            }
+            T alpha = rho / curvature;
+            for (size_t i = 0; i < n; ++i) {
+                solution[i] += alpha * direction[i];
+                residual[i] -= alpha * product[i];
+                preconditioned[i] = residual[i] * inverse_diagonal[i];
+            }
+            T next = dot(residual, preconditioned);
+            for (size_t i = 0; i < n; ++i) {
+                direction[i] = preconditioned[i] + next / rho * direction[i];
+            }
+            rho = next;
+        }
+        for (size_t i = 0; i < n; ++i) {
+            x(i, column) = solution[i];
+        }
+    }
+    return x;
+}
+
+template <class T>
+Matrix<T> SolveLinearSystem(const CscMatrix<T>& a, const Matrix<T>& b, const SparseSolverOptions& options = {}) {
+    return SolveLinearSystem(CsrMatrix<T>(a), b, options);
+}
+
+#endif  // MATRIX_ARRAY_SPARSE_MATRIX_H
@@ -0,0 +1,240 @@
+#ifndef PARALLEL_ALGORITHMS_PARALLEL_ALGORITHMS_H
+#define PARALLEL_ALGORITHMS_PARALLEL_ALGORITHMS_H
+
+#include <util/thread_pool.h>
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <numeric>
+#include <optional>
+#include <ranges>
+#include <span>
+#include <utility>
+#include <vector>
+
+const size_t kParallelCutoff = 1 << 14;
+
+struct ParallelOptions {
+    size_t cutoff_ = kParallelCutoff;  // ranges up to this length are processed sequentially
+    bool deterministic_ = true;        // chunking and combination order do not depend on the number of threads
+    ThreadPool* pool_ = nullptr;       // DefaultThreadPool() if null
+};
+
+template <class Range>
+concept ContiguousRange = std::ranges::contiguous_range<Range> && std::ranges::sized_range<Range>;
+
+namespace parallel_detail {
+
+inline ThreadPool& Pool(const ParallelOptions& options) {
+    return options.pool_ ? *options.pool_ : DefaultThreadPool();
+}
+
+inline size_t ChunkSize(const size_t& size, const ParallelOptions& options) {
+    size_t cutoff = std::max<size_t>(1, options.cutoff_);
+    if (options.deterministic_) {
+        return cutoff;
+    }
+    size_t chunks = Pool(options).Size() * 4;
+    return std::max(cutoff, (size + chunks - 1) / chunks);
+}
+
+// Calls function(first, last) for consecutive chunks of [0, size).
+template <class Function>
+void ForEachChunk(const size_t& size, const size_t& chunk, const ParallelOptions& options, Function&& function) {
+    if (size <= chunk) {
+        if (size > 0) {
+            function(size_t{0}, size);
+        }
+        return;
+    }
+    TaskGroup group(Pool(options));
+    for (size_t first = chunk; first < size; first += chunk) {
+        group.Run([&function, first, last = std::min(first + chunk, size)] { function(first, last); });
+    }
+    function(size_t{0}, chunk);
+    group.Wait();
+}
+
+template <class T, class Compare>
+void Merge(std::span<T> left, std::span<T> right, T* out, Compare& compare, const ParallelOptions& options) {
+    if (left.size() + right.size() <= std::max<size_t>(options.cutoff_, 2)) {
+        std::merge(std::make_move_iterator(left.begin()), std::make_move_iterator(left.end()),
+                   std::make_move_iterator(right.begin()), std::make_move_iterator(right.end()), out, compare);
+        return;
+    }
+    size_t left_mid = 0;
+    size_t right_mid = 0;
+    if (left.size() >= right.size()) {
+        left_mid = left.size() / 2;
+        right_mid = std::lower_bound(right.begin(), right.end(), left[left_mid], compare) - right.begin();
+    } else {
+        right_mid = right.size() / 2;
+        left_mid = std::upper_bound(left.begin(), left.end(), right[right_mid], compare) - left.begin();
+    }
+    TaskGroup group(Pool(options));
+    group.Run([&] { Merge(left.first(left_mid), right.first(right_mid), out, compare, options); });
+    Merge(left.subspan(left_mid), right.subspan(right_mid), out + left_mid + right_mid, compare, options);
+    group.Wait();
+}
+
+// Sorts from, leaving the result in to if into_to is set. Both ranges hold live objects.
+template <class T, class Compare>
+void MergeSort(std::span<T> from, std::span<T> to, const bool& into_to, const bool& stable, Compare& compare,
+               const ParallelOptions& options) {
+    if (from.size() <= std::max<size_t>(1, options.cutoff_)) {
+        stable ? std::stable_sort(from.begin(), from.end(), compare) : std::sort(from.begin(), from.end(), compare);
+        if (into_to) {
+            std::move(from.begin(), from.end(), to.begin());
+        }
+        return;
+    }
+    size_t mid = from.size() / 2;
+    TaskGroup group(Pool(options));
+    group.Run([&] { MergeSort(from.first(mid), to.first(mid), !into_to, stable, compare, options); });
+    MergeSort(from.subspan(mid), to.subspan(mid), !into_to, stable, compare, options);
+    group.Wait();
+    std::span<T> source = into_to ? from : to;
+    Merge(source.first(mid), source.subspan(mid), (into_to ? to : from).data(), compare, options);
+}
+
+template <class T, class Compare>
+void Sort(std::span<T> data, const bool& stable, Compare& compare, const ParallelOptions& options) {
+    if (data.size() <= std::max<size_t>(1, options.cutoff_)) {
+        stable ? std::stable_sort(data.begin(), data.end(), compare) : std::sort(data.begin(), data.end(), compare);
+        return;
+    }
+    std::vector<T> buffer(std::make_move_iterator(data.begin()), std::make_move_iterator(data.end()));
+    MergeSort(std::span<T>(buffer), data, true, stable, compare, options);
+}
+
+template <class T, class Predicate>
+T* Partition(T* first, T* last, Predicate& predicate, const ParallelOptions& options) {
+    if (static_cast<size_t>(last - first) <= std::max<size_t>(1, options.cutoff_)) {
+        return std::partition(first, last, predicate);
+    }
+    T* middle = first + (last - first) / 2;
+    T* left = nullptr;
+    TaskGroup group(Pool(options));
+    group.Run([&] { left = Partition(first, middle, predicate, options); });
+    T* right = Partition(middle, last, predicate, options);
+    group.Wait();
+    return std::rotate(left, middle, right);
+}
+
+}  // namespace parallel_detail
+
+template <ContiguousRange Range, class Compare = std::less<>>
+void ParallelSort(Range&& range, Compare compare = Compare{}, const ParallelOptions& options = {}) {
+    parallel_detail::Sort(std::span(range), false, compare, options);
+}
+
+template <ContiguousRange Range, class Compare = std::less<>>
+void ParallelStableSort(Range&& range, Compare compare = Compare{}, const ParallelOptions& options = {}) {
+    parallel_detail::Sort(std::span(range), true, compare, options);
+}
+
+// Chunk results are folded left to right in both modes, so operation only has to be associative. In deterministic mode
+// the chunks have the fixed length options.cutoff_, so the result is also reproducible for operations that are
+// associative only up to rounding, such as floating point addition.
+template <ContiguousRange Range, class T, class BinaryOperation = std::plus<>>
+T ParallelReduce(Range&& range, T init, BinaryOperation operation = BinaryOperation{},
+                 const ParallelOptions& options = {}) {
+    auto data = std::span(range);
+    size_t chunk = parallel_detail::ChunkSize(data.size(), options);
+    auto reduce_chunk = [&](const size_t& first, const size_t& last) {
+        T partial = data[first];
+        for (size_t i = first + 1; i < last; ++i) {
+            partial = operation(std::move(partial), data[i]);
+        }
+        return partial;
+    };
+    if (data.empty()) {
+        return init;
+    }
+    std::vector<std::optional<T>> partials((data.size() + chunk - 1) / chunk);
+    parallel_detail::ForEachChunk(data.size(), chunk, options, [&](const size_t& first, const size_t& last) {
+        partials[first / chunk].emplace(reduce_chunk(first, last));
+    });
+    for (auto& partial : partials) {
+        init = operation(std::move(init), std::move(*partial));
+    }
+    return init;
+}
+
+template <ContiguousRange Input, ContiguousRange Output, class UnaryOperation>
+void ParallelTransform(Input&& input, Output&& output, UnaryOperation operation, const ParallelOptions& options = {}) {
+    auto in = std::span(input);
+    auto out = std::span(output);
+    size_t chunk = parallel_detail::ChunkSize(in.size(), options);
+    parallel_detail::ForEachChunk(in.size(), chunk, options, [&](const size_t& first, const size_t& last) {
+        std::transform(in.begin() + first, in.begin() + last, out.begin() + first, operation);
+    });
+}
+
+namespace parallel_detail {
+
+// Two passes over fixed chunks: chunk totals in parallel, their prefix sums sequentially, then every chunk is scanned
+// from the value preceding it. offsets[0] may hold the initial value.
+template <class T, class In, class Out, class BinaryOperation>
+void Scan(std::span<In> in, std::span<Out> out, std::vector<std::optional<T>>& offsets, const bool& inclusive,
+          BinaryOperation& operation, const ParallelOptions& options) {
+    size_t chunk = std::max<size_t>(1, options.cutoff_);
+    std::vector<std::optional<T>> totals(offsets.size());
+    ForEachChunk(in.size(), chunk, options, [&](const size_t& first, const size_t& last) {
+        T total = in[first];
+        for (size_t i = first + 1; i < last; ++i) {
+            total = operation(std::move(total), in[i]);
+        }
+        totals[first / chunk].emplace(std::move(total));
+    });
+    for (size_t i = 1; i < offsets.size(); ++i) {
+        offsets[i].emplace(offsets[i - 1] ? operation(*offsets[i - 1], std::move(*totals[i - 1]))
+                                          : std::move(*totals[i - 1]));
+    }
+    ForEachChunk(in.size(), chunk, options, [&](const size_t& first, const size_t& last) {
+        auto& offset = offsets[first / chunk];
+        if (inclusive && offset) {
+            std::inclusive_scan(in.begin() + first, in.begin() + last, out.begin() + first, operation, *offset);
+        } else if (inclusive) {
+            std::inclusive_scan(in.begin() + first, in.begin() + last, out.begin() + first, operation);
+        } else {
+            std::exclusive_scan(in.begin() + first, in.begin() + last, out.begin() + first, *offset, operation);
+        }
+    });
+}
+
+}  // namespace parallel_detail
+
+// output may coincide with input.
+template <ContiguousRange Input, ContiguousRange Output, class BinaryOperation = std::plus<>>
+void ParallelInclusiveScan(Input&& input, Output&& output, BinaryOperation operation = BinaryOperation{},
+                           const ParallelOptions& options = {}) {
+    auto in = std::span(input);
+    size_t chunk = std::max<size_t>(1, options.cutoff_);
+    std::vector<std::optional<std::ranges::range_value_t<Output>>> offsets((in.size() + chunk - 1) / chunk);
+    parallel_detail::Scan(in, std::span(output), offsets, true, operation, options);
+}
+
+template <ContiguousRange Input, ContiguousRange Output, class T, class BinaryOperation = std::plus<>>
+void ParallelExclusiveScan(Input&& input, Output&& output, T init, BinaryOperation operation = BinaryOperation{},
+                           const ParallelOptions& options = {}) {
+    auto in = std::span(input);
+    size_t chunk = std::max<size_t>(1, options.cutoff_);
+    std::vector<std::optional<T>> offsets((in.size() + chunk - 1) / chunk);
+    if (!offsets.empty()) {
+        offsets[0].emplace(std::move(init));
+    }
+    parallel_detail::Scan(in, std::span(output), offsets, false, operation, options);
+}
+
+// Unstable. Returns the number of elements satisfying predicate, which are moved to the front.
+template <ContiguousRange Range, class Predicate>
+size_t ParallelPartition(Range&& range, Predicate predicate, const ParallelOptions& options = {}) {
+    auto data = std::span(range);
+    ParallelOptions chunked = options;
+    chunked.cutoff_ = parallel_detail::ChunkSize(data.size(), options);
+    return parallel_detail::Partition(data.data(), data.data() + data.size(), predicate, chunked) - data.data();
+}
+
+#endif  // PARALLEL_ALGORITHMS_PARALLEL_ALGORITHMS_H
@@ -0,0 +1,114 @@
+#ifndef UTIL_BULK_MEMORY_H
+#define UTIL_BULK_MEMORY_H
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <type_traits>
+#include <utility>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Past this size the data no longer fits in a typical last-level cache share, so bulk writes bypass the cache.
+const size_t kNonTemporalThreshold = size_t{1} << 22;
+
+inline bool IsAligned(const void* pointer, size_t alignment) {
+    return reinterpret_cast<uintptr_t>(pointer) % alignment == 0;
+}
+
+inline void SwapBytes(unsigned char* f, unsigned char* s, size_t n) {
+    size_t i = 0;
+    auto offset = reinterpret_cast<uintptr_t>(f) ^ reinterpret_cast<uintptr_t>(s);
+    [[maybe_unused]] bool stream = n >= kNonTemporalThreshold && offset % 32 == 0;
+#ifdef __AVX2__
+    if (stream) {
+        for (; i < n && !IsAligned(f + i, 32); ++i) {
+            std::swap(f[i], s[i]);
+        }
+        for (; i + 32 <= n; i += 32) {
+            __m256i a = _mm256_load_si256(reinterpret_cast<const __m256i*>(f + i));
+            __m256i b = _mm256_load_si256(reinterpret_cast<const __m256i*>(s + i));
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(f + i), b);
+            _mm256_stream_si256(reinterpret_cast<__m256i*>(s + i), a);
+        }
+        _mm_sfence();
+    }
+    for (; i + 32 <= n; i += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(f + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(f + i), b);
+        _mm256_storeu_si256(reinterpret_cast<__m256i*>(s + i), a);
+    }
+#elif defined(__SSE2__)
+    if (stream) {
+        for (; i < n && !IsAligned(f + i, 16); ++i) {
+            std::swap(f[i], s[i]);
+        }
+        for (; i + 16 <= n; i += 16) {
+            __m128i a = _mm_load_si128(reinterpret_cast<const __m128i*>(f + i));
+            __m128i b = _mm_load_si128(reinterpret_cast<const __m128i*>(s + i));
+            _mm_stream_si128(reinterpret_cast<__m128i*>(f + i), b);
+            _mm_stream_si128(reinterpret_cast<__m128i*>(s + i), a);
+        }
+        _mm_sfence();
+    }
+#endif
+#ifdef __SSE2__
+    for (; i + 16 <= n; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(f + i), b);
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(s + i), a);
+    }
+#endif
+    for (; i < n; ++i) {
+        std::swap(f[i], s[i]);
+    }
+}
+
+template <class T>
+void SwapTrivial(T* f, T* s, size_t count) {
+    static_assert(std::is_trivially_copyable_v<T>, "NotTriviallyCopyable");
+    SwapBytes(reinterpret_cast<unsigned char*>(f), reinterpret_cast<unsigned char*>(s), count * sizeof(T));
+}
+
+// Values whose bytes are all equal (zeros, -1, chars) are filled with memset. Large fills of power-of-two sized values
+// repeat the value across a vector register and use non-temporal stores.
+template <class T>
+void FillTrivial(T* first, size_t count, const T& value) {
+    static_assert(std::is_trivially_copyable_v<T>, "NotTriviallyCopyable");
+    unsigned char bytes[sizeof(T)];
+    std::memcpy(bytes, &value, sizeof(T));
+    if (std::all_of(bytes, bytes + sizeof(T), [&](unsigned char byte) { return byte == bytes[0]; })) {
+        std::memset(first, bytes[0], count * sizeof(T));
+        return;
+    }
+#ifdef __SSE2__
+    if (count * sizeof(T) >= kNonTemporalThreshold && std::has_single_bit(sizeof(T)) && sizeof(T) <= 16 &&
+        IsAligned(first, sizeof(T))) {
+        alignas(16) unsigned char pattern[16];
+        for (size_t i = 0; i < 16; i += sizeof(T)) {
+            std::memcpy(pattern + i, bytes, sizeof(T));
+        }
+        size_t head = 0;
+        for (; head < count && !IsAligned(first + head, 16); ++head) {
+            first[head] = value;
+        }
+        auto out = reinterpret_cast<unsigned char*>(first + head);
+        size_t n = (count - head) * sizeof(T) / 16 * 16;
+        __m128i vector = _mm_load_si128(reinterpret_cast<const __m128i*>(pattern));
+        for (size_t i = 0; i < n; i += 16) {
+            _mm_stream_si128(reinterpret_cast<__m128i*>(out + i), vector);
+        }
+        _mm_sfence();
+        std::fill(first + head + n / sizeof(T), first + count, value);
+        return;
+    }
+#endif
+    std::fill(first, first + count, value);
+}
+
+#endif  // UTIL_BULK_MEMORY_H
@@ -0,0 +1,104 @@
+#ifndef UTIL_COMPARE_H
+#define UTIL_COMPARE_H
+
+#include <bit>
+#include <compare>
+#include <cstddef>
+#include <cstring>
+#include <type_traits>
+#if defined(__AVX2__) || defined(__SSE2__)
+#include <immintrin.h>
+#endif
+
+// Equal object representations imply equal values. Limited to scalars without padding or floating point: a class
+// type may define its own comparisons, under which different bytes still compare equal.
+template <class T>
+constexpr bool kIsBitwiseComparable = (std::is_integral_v<T> || std::is_enum_v<T> || std::is_pointer_v<T>) &&
+                                      std::has_unique_object_representations_v<T>;
+
+// memcmp order coincides with the value order.
+template <class T>
+constexpr bool kIsBytewiseOrdered =
+    kIsBitwiseComparable<T> && sizeof(T) == 1 && (std::is_unsigned_v<T> || std::is_same_v<T, std::byte>);
+
+inline size_t FindMismatchBytes(const unsigned char* f, const unsigned char* s, size_t n) {
+    size_t i = 0;
+#ifdef __AVX2__
+    for (; i + 32 <= n; i += 32) {
+        __m256i a = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(f + i));
+        __m256i b = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(s + i));
+        auto mask = ~static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(a, b)));
+        if (mask != 0) {
+            return i + std::countr_zero(mask);
+        }
+    }
+#endif
+#ifdef __SSE2__
+    for (; i + 16 <= n; i += 16) {
+        __m128i a = _mm_loadu_si128(reinterpret_cast<const __m128i*>(f + i));
+        __m128i b = _mm_loadu_si128(reinterpret_cast<const __m128i*>(s + i));
+        auto mask = ~static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(a, b))) & 0xFFFFu;
+        if (mask != 0) {
+            return i + std::countr_zero(mask);
+        }
+    }
+#endif
+    for (; i < n && f[i] == s[i]; ++i) {
+    }
+    return i;
+}
+
+template <class T>
+constexpr size_t FindMismatch(const T* f, const T* s, size_t n) {
+    if constexpr (kIsBitwiseComparable<T>) {
+        if (!std::is_constant_evaluated()) {
+            return FindMismatchBytes(reinterpret_cast<const unsigned char*>(f),
+                                     reinterpret_cast<const unsigned char*>(s), n * sizeof(T)) /
+                   sizeof(T);
+        }
+    }
+    size_t i = 0;
+    for (; i < n && !(f[i] > s[i]) && !(f[i] < s[i]); ++i) {
+    }
+    return i;
+}
+
+template <class T>
+constexpr bool RangesEqual(const T* f, size_t n, const T* s, size_t m) {
+    if (n != m) {
+        return false;
+    }
+    if constexpr (kIsBitwiseComparable<T>) {
+        if (!std::is_constant_evaluated()) {
+            return n == 0 || std::memcmp(f, s, n * sizeof(T)) == 0;
+        }
+    }
+    return FindMismatch(f, s, n) == n;
+}
+
+template <class T>
+constexpr std::weak_ordering LexicographicCompare(const T* f, size_t n, const T* s, size_t m) {
+    size_t common = n < m ? n : m;
+    if constexpr (kIsBytewiseOrdered<T>) {
+        if (!std::is_constant_evaluated()) {
+            int result = common == 0 ? 0 : std::memcmp(f, s, common);
+            if (result != 0) {
+                return result < 0 ? std::weak_ordering::less : std::weak_ordering::greater;
+            }
+            return n <=> m;
+        }
+    }
+    // Resumes past elements that are neither less nor greater instead of taking them for a mismatch.
+    size_t i = FindMismatch(f, s, common);
+    for (; i < common; i += 1 + FindMismatch(f + i + 1, s + i + 1, common - i - 1)) {
+        if (f[i] < s[i]) {
+            return std::weak_ordering::less;
+        }
+        if (f[i] > s[i]) {
+            return std::weak_ordering::greater;
+        }
+    }
+    return n <=> m;
+}
+
+#endif  // UTIL_COMPARE_H
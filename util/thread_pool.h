@@ -0,0 +1,199 @@
+#ifndef UTIL_THREAD_POOL_H
+#define UTIL_THREAD_POOL_H
+
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <deque>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <utility>
+#include <vector>
+
+// Every worker owns a deque: it pushes and pops its own tasks at the back and steals from the front of the others.
+// Threads outside the pool share one extra deque.
+class ThreadPool {
+    struct Queue {
+        std::mutex mutex_;
+        std::deque<std::function<void()>> tasks_;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::vector<std::thread> workers_;
+    std::atomic<size_t> pending_;
+    std::mutex sleep_mutex_;
+    std::condition_variable wake_;
+    bool stop_;
+
+    static inline thread_local ThreadPool* current_pool_ = nullptr;
+    static inline thread_local size_t current_queue_ = 0;
+
+    size_t OwnQueue() const;
+    bool TryPop(const size_t&, std::function<void()>&, const bool&);
+    void WorkerLoop(const size_t&);
+
+public:
+    explicit ThreadPool(const size_t& threads = std::max<size_t>(1, std::thread::hardware_concurrency()));
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+    ~ThreadPool();
+    void Submit(std::function<void()>);
+    bool TryRunOne(const bool& steal_newest = false);
+    size_t Size() const;
+};
+
+// Fork-join scope over a pool. Wait() runs queued tasks instead of blocking, so groups may be nested inside tasks.
+class TaskGroup {
+    ThreadPool& pool_;
+    std::atomic<size_t> running_;
+    std::mutex exception_mutex_;
+    std::exception_ptr exception_;
+
+public:
+    explicit TaskGroup(ThreadPool&);
+    TaskGroup(const TaskGroup&) = delete;
+    TaskGroup& operator=(const TaskGroup&) = delete;
+    ~TaskGroup();
+    template <class Function>
+    TaskGroup& Run(Function&&);
+    TaskGroup& Wait();
+};
+
+inline ThreadPool& DefaultThreadPool() {
+    static ThreadPool pool;
+    return pool;
+}
+
+inline ThreadPool::ThreadPool(const size_t& threads) : pending_(0), stop_(false) {
+    size_t count = std::max<size_t>(1, threads);
+    for (size_t i = 0; i <= count; ++i) {
+        queues_.push_back(std::make_unique<Queue>());
+    }
+    for (size_t i = 0; i < count; ++i) {
+        workers_.emplace_back([this, i] { WorkerLoop(i); });
+    }
+}
+
+inline ThreadPool::~ThreadPool() {
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+        stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto& worker : workers_) {
+        worker.join();
+    }
+}
+
+inline bool ThreadPool::TryPop(const size_t& queue, std::function<void()>& task, const bool& back) {
+    std::lock_guard<std::mutex> lock(queues_[queue]->mutex_);
+    auto& tasks = queues_[queue]->tasks_;
+    if (tasks.empty()) {
+        return false;
+    }
+    if (back) {
+        task = std::move(tasks.back());
+        tasks.pop_back();
+    } else {
+        task = std::move(tasks.front());
+        tasks.pop_front();
+    }
+    pending_.fetch_sub(1, std::memory_order_relaxed);
+    return true;
+}
+
+inline size_t ThreadPool::OwnQueue() const {
+    return current_pool_ == this ? current_queue_ : workers_.size();
+}
+
+inline void ThreadPool::Submit(std::function<void()> task) {
+    size_t queue = OwnQueue();
+    {
+        std::lock_guard<std::mutex> lock(queues_[queue]->mutex_);
+        queues_[queue]->tasks_.push_back(std::move(task));
+    }
+    pending_.fetch_add(1, std::memory_order_relaxed);
+    {
+        std::lock_guard<std::mutex> lock(sleep_mutex_);
+    }
+    wake_.notify_one();
+}
+
+// A thread waiting for its own children takes the newest foreign tasks, which are the smallest ones,
+// so that the tasks nested on its stack stay shallow.
+inline bool ThreadPool::TryRunOne(const bool& steal_newest) {
+    std::function<void()> task;
+    size_t own = OwnQueue();
+    bool found = TryPop(own, task, true);
+    for (size_t i = 1; !found && i < queues_.size(); ++i) {
+        found = TryPop((own + i) % queues_.size(), task, steal_newest);
+    }
+    if (found) {
+        task();
+    }
+    return found;
+}
+
+inline void ThreadPool::WorkerLoop(const size_t& queue) {
+    current_pool_ = this;
+    current_queue_ = queue;
+    while (true) {
+        if (TryRunOne()) {
+            continue;
+        }
+        std::unique_lock<std::mutex> lock(sleep_mutex_);
+        wake_.wait(lock, [this] { return stop_ || pending_.load(std::memory_order_relaxed) > 0; });
+        if (stop_ && pending_.load(std::memory_order_relaxed) == 0) {
+            return;
+        }
+    }
+}
+
+inline size_t ThreadPool::Size() const {
+    return workers_.size();
+}
+
+inline TaskGroup::TaskGroup(ThreadPool& pool) : pool_(pool), running_(0) {
+}
+
+inline TaskGroup::~TaskGroup() {
+    try {
+        Wait();
+    } catch (...) {
+    }
+}
+
+template <class Function>
+TaskGroup& TaskGroup::Run(Function&& function) {
+    running_.fetch_add(1, std::memory_order_relaxed);
+    pool_.Submit([this, function = std::forward<Function>(function)]() mutable {
+        try {
+            function();
+        } catch (...) {
+            std::lock_guard<std::mutex> lock(exception_mutex_);
+            if (!exception_) {
+                exception_ = std::current_exception();
+            }
+        }
+        running_.fetch_sub(1, std::memory_order_release);
+    });
+    return *this;
+}
+
+inline TaskGroup& TaskGroup::Wait() {
+    while (running_.load(std::memory_order_acquire) > 0) {
+        if (!pool_.TryRunOne(true)) {
+            std::this_thread::yield();
+        }
+    }
+    if (exception_) {
+        std::rethrow_exception(std::exchange(exception_, nullptr));
+    }
+    return *this;
+}
+
+#endif  // UTIL_THREAD_POOL_H
@@ -0,0 +1,224 @@
+#ifndef VECTOR_CONCURRENT_VECTOR_H
+#define VECTOR_CONCURRENT_VECTOR_H
+
+#include "vector.h"
+#include <algorithm>
+#include <atomic>
+#include <bit>
+#include <memory>
+#include <mutex>
+#include <utility>
+#include <vector>
+
+const size_t kConcurrentVectorFirstSegmentLog = 3;
+const size_t kConcurrentVectorSegmentsNumber = 64 - kConcurrentVectorFirstSegmentLog;
+
+// Segments of 8, 16, 32, ... slots are never moved, so references stay valid while other threads append.
+// An element may be read by another thread once the PushBack/GrowBy that created it happens-before the read.
+// Indices are claimed before construction and cannot be given back, so the slots of a PushBack/GrowBy that threw stay
+// counted by Size() but hold no element; they must not be accessed, and Clear() skips them.
+template <class T, class Allocator = std::allocator<T>>
+class ConcurrentVector {
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+
+    std::atomic<T*> segments_[kConcurrentVectorSegmentsNumber];
+    std::atomic<size_t> size_;
+    [[no_unique_address]] Allocator allocator_;
+    std::mutex failed_mutex_;
+    std::vector<std::pair<size_t, size_t>> failed_;
+
+    static size_t SegmentIndex(const size_t&);
+    static size_t SegmentBegin(const size_t&);
+    static size_t SegmentSize(const size_t&);
+    T* Segment(const size_t&);
+    T* Slot(const size_t&);
+    void MarkFailed(const size_t&, const size_t&);
+
+public:
+    struct Range {
+        size_t first_;
+        size_t last_;
+    };
+
+    ConcurrentVector();
+    explicit ConcurrentVector(const Allocator&);
+    ConcurrentVector(const ConcurrentVector<T, Allocator>&) = delete;
+    ConcurrentVector<T, Allocator>& operator=(const ConcurrentVector<T, Allocator>&) = delete;
+    ~ConcurrentVector();
+    T& PushBack(const T&);
+    Range GrowBy(const size_t&);
+    ConcurrentVector<T, Allocator>& Reserve(const size_t&);
+    ConcurrentVector<T, Allocator>& Clear();
+    const T& operator[](const size_t&) const;
+    T& operator[](const size_t&);
+    const T& At(const size_t&) const;
+    T& At(const size_t&);
+    bool Empty() const;
+    size_t Size() const;
+};
+
+template <class T, class Allocator>
+size_t ConcurrentVector<T, Allocator>::SegmentIndex(const size_t& index) {
+    return std::bit_width((index >> kConcurrentVectorFirstSegmentLog) + 1) - 1;
+}
+
+template <class T, class Allocator>
+size_t ConcurrentVector<T, Allocator>::SegmentBegin(const size_t& segment) {
+    return ((size_t{1} << segment) - 1) << kConcurrentVectorFirstSegmentLog;
+}
+
+template <class T, class Allocator>
+size_t ConcurrentVector<T, Allocator>::SegmentSize(const size_t& segment) {
+    return size_t{1} << (segment + kConcurrentVectorFirstSegmentLog);
+}
+
+template <class T, class Allocator>
+T* ConcurrentVector<T, Allocator>::Segment(const size_t& segment) {
+    T* pointer = segments_[segment].load(std::memory_order_acquire);
+    if (pointer) {
+        return pointer;
+    }
+    T* allocated = AllocatorTraits::allocate(allocator_, SegmentSize(segment));
+    if (segments_[segment].compare_exchange_strong(pointer, allocated, std::memory_order_acq_rel)) {
+        return allocated;
+    }
+    AllocatorTraits::deallocate(allocator_, allocated, SegmentSize(segment));
+    return pointer;
+}
+
+template <class T, class Allocator>
+T* ConcurrentVector<T, Allocator>::Slot(const size_t& index) {
+    size_t segment = SegmentIndex(index);
+    return Segment(segment) + (index - SegmentBegin(segment));
+}
+
+template <class T, class Allocator>
+void ConcurrentVector<T, Allocator>::MarkFailed(const size_t& first, const size_t& last) {
+    std::lock_guard<std::mutex> lock(failed_mutex_);
+    failed_.emplace_back(first, last);
+}
+
+template <class T, class Allocator>
+ConcurrentVector<T, Allocator>::ConcurrentVector() : ConcurrentVector(Allocator()) {
+}
+
+template <class T, class Allocator>
+ConcurrentVector<T, Allocator>::ConcurrentVector(const Allocator& allocator) : size_(0), allocator_(allocator) {
+    for (auto& segment : segments_) {
+        segment.store(nullptr, std::memory_order_relaxed);
+    }
+}
+
+template <class T, class Allocator>
+ConcurrentVector<T, Allocator>::~ConcurrentVector() {
+    Clear();
+    for (size_t i = 0; i < kConcurrentVectorSegmentsNumber; ++i) {
+        T* segment = segments_[i].load(std::memory_order_relaxed);
+        if (segment) {
+            AllocatorTraits::deallocate(allocator_, segment, SegmentSize(i));
+        }
+    }
+}
+
+template <class T, class Allocator>
+T& ConcurrentVector<T, Allocator>::PushBack(const T& value) {
+    size_t index = size_.fetch_add(1, std::memory_order_relaxed);
+    try {
+        T* slot = Slot(index);
+        AllocatorTraits::construct(allocator_, slot, value);
+        return *slot;
+    } catch (...) {
+        MarkFailed(index, index + 1);
+        throw;
+    }
+}
+
+template <class T, class Allocator>
+typename ConcurrentVector<T, Allocator>::Range ConcurrentVector<T, Allocator>::GrowBy(const size_t& count) {
+    size_t first = size_.fetch_add(count, std::memory_order_relaxed);
+    size_t last = first + count;
+    size_t index = first;
+    try {
+        while (index < last) {
+            size_t segment = SegmentIndex(index);
+            size_t segment_end = std::min(SegmentBegin(segment) + SegmentSize(segment), last);
+            T* slot = Segment(segment) + (index - SegmentBegin(segment));
+            UninitializedValueConstruct(allocator_, slot, segment_end - index);
+            index = segment_end;
+        }
+    } catch (...) {
+        for (size_t built = first; built < index; ++built) {
+            AllocatorTraits::destroy(allocator_, Slot(built));
+        }
+        MarkFailed(first, last);
+        throw;
+    }
+    return {first, last};
+}
+
+template <class T, class Allocator>
+ConcurrentVector<T, Allocator>& ConcurrentVector<T, Allocator>::Reserve(const size_t& new_cap) {
+    if (new_cap > 0) {
+        for (size_t segment = 0; segment <= SegmentIndex(new_cap - 1); ++segment) {
+            Segment(segment);
+        }
+    }
+    return *this;
+}
+
+template <class T, class Allocator>
+ConcurrentVector<T, Allocator>& ConcurrentVector<T, Allocator>::Clear() {
+    size_t size = size_.exchange(0, std::memory_order_relaxed);
+    std::sort(failed_.begin(), failed_.end());
+    auto failed = failed_.begin();
+    for (size_t index = 0; index < size; ++index) {
+        if (failed != failed_.end() && index == failed->first) {
+            index = failed->second - 1;
+            ++failed;
+            continue;
+        }
+        AllocatorTraits::destroy(allocator_, Slot(index));
+    }
+    failed_.clear();
+    return *this;
+}
+
+template <class T, class Allocator>
+T& ConcurrentVector<T, Allocator>::operator[](const size_t& index) {
+    size_t segment = SegmentIndex(index);
+    return segments_[segment].load(std::memory_order_acquire)[index - SegmentBegin(segment)];
+}
+
+template <class T, class Allocator>
+const T& ConcurrentVector<T, Allocator>::operator[](const size_t& index) const {
+    size_t segment = SegmentIndex(index);
+    return segments_[segment].load(std::memory_order_acquire)[index - SegmentBegin(segment)];
+}
+
+template <class T, class Allocator>
+T& ConcurrentVector<T, Allocator>::At(const size_t& index) {
+    if (index >= Size()) {
+        throw VectorOutOfRange{};
+    }
+    return (*this)[index];
+}
+
+template <class T, class Allocator>
+const T& ConcurrentVector<T, Allocator>::At(const size_t& index) const {
+    if (index >= Size()) {
+        throw VectorOutOfRange{};
+    }
+    return (*this)[index];
+}
+
+template <class T, class Allocator>
+bool ConcurrentVector<T, Allocator>::Empty() const {
+    return Size() == 0;
+}
+
+template <class T, class Allocator>
+size_t ConcurrentVector<T, Allocator>::Size() const {
+    return size_.load(std::memory_order_acquire);
+}
+
+#endif  // VECTOR_CONCURRENT_VECTOR_H
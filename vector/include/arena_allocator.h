@@ -0,0 +1,135 @@
+#ifndef VECTOR_ARENA_ALLOCATOR_H
+#define VECTOR_ARENA_ALLOCATOR_H
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <type_traits>
+
+const size_t kArenaBlockSize = 4096;
+
+class Arena {
+    struct Block {
+        Block* next_;
+        size_t size_;
+    };
+
+    Block* head_;
+    char* current_;
+    char* end_;
+    size_t block_size_;
+
+    Arena& AddBlock(const size_t&);
+
+public:
+    explicit Arena(const size_t& block_size = kArenaBlockSize);
+    Arena(const Arena&) = delete;
+    Arena& operator=(const Arena&) = delete;
+    ~Arena();
+    void* Allocate(const size_t&, const size_t&);
+    Arena& Reset();
+};
+
+inline Arena::Arena(const size_t& block_size)
+    : head_(nullptr), current_(nullptr), end_(nullptr), block_size_(block_size) {
+}
+
+inline Arena::~Arena() {
+    Reset();
+}
+
+inline Arena& Arena::AddBlock(const size_t& min_size) {
+    size_t size = block_size_;
+    while (size < min_size + sizeof(Block)) {
+        size *= 2;
+    }
+    auto block = static_cast<Block*>(::operator new(size));
+    block->next_ = head_;
+    block->size_ = size;
+    head_ = block;
+    current_ = reinterpret_cast<char*>(block + 1);
+    end_ = reinterpret_cast<char*>(block) + size;
+    block_size_ = size * 2;
+    return *this;
+}
+
+inline void* Arena::Allocate(const size_t& bytes, const size_t& alignment) {
+    auto address = reinterpret_cast<uintptr_t>(current_);
+    auto aligned = (address + alignment - 1) & ~(alignment - 1);
+    if (current_ == nullptr || aligned + bytes > reinterpret_cast<uintptr_t>(end_)) {
+        AddBlock(bytes + alignment);
+        address = reinterpret_cast<uintptr_t>(current_);
+        aligned = (address + alignment - 1) & ~(alignment - 1);
+    }
+    current_ = reinterpret_cast<char*>(aligned + bytes);
+    return reinterpret_cast<void*>(aligned);
+}
+
+inline Arena& Arena::Reset() {
+    while (head_) {
+        Block* next = head_->next_;
+        ::operator delete(head_);
+        head_ = next;
+    }
+    current_ = end_ = nullptr;
+    return *this;
+}
+
+template <class T>
+class ArenaAllocator {
+    Arena* arena_;
+
+    template <class U>
+    friend class ArenaAllocator;
+
+public:
+    using value_type = T;                                           //  NOLINT
+    using propagate_on_container_copy_assignment = std::true_type;  //  NOLINT
+    using propagate_on_container_move_assignment = std::true_type;  //  NOLINT
+    using propagate_on_container_swap = std::true_type;             //  NOLINT
+
+    explicit ArenaAllocator(Arena&);
+    template <class U>
+    ArenaAllocator(const ArenaAllocator<U>&);  //  NOLINT
+    T* allocate(size_t);                       //  NOLINT
+    void deallocate(T*, size_t);               //  NOLINT
+    template <class U>
+    bool operator==(const ArenaAllocator<U>&) const;
+    template <class U>
+    bool operator!=(const ArenaAllocator<U>&) const;
+};
+
+template <class T>
+ArenaAllocator<T>::ArenaAllocator(Arena& arena) : arena_(&arena) {
+}
+
+template <class T>
+template <class U>
+ArenaAllocator<T>::ArenaAllocator(const ArenaAllocator<U>& other) : arena_(other.arena_) {
+}
+
+template <class T>
+T* ArenaAllocator<T>::allocate(size_t n) {  //  NOLINT
+    if (n > static_cast<size_t>(-1) / sizeof(T)) {
+        throw std::bad_array_new_length{};
+    }
+    return static_cast<T*>(arena_->Allocate(n * sizeof(T), alignof(T)));
+}
+
+template <class T>
+void ArenaAllocator<T>::deallocate(T*, size_t) {  //  NOLINT
+}
+
+template <class T>
+template <class U>
+bool ArenaAllocator<T>::operator==(const ArenaAllocator<U>& other) const {
+    return arena_ == other.arena_;
+}
+
+template <class T>
+template <class U>
+bool ArenaAllocator<T>::operator!=(const ArenaAllocator<U>& other) const {
+    return !(*this == other);
+}
+
+#endif  // VECTOR_ARENA_ALLOCATOR_H
@@ -0,0 +1,90 @@
+#ifndef VECTOR_HUGE_PAGE_ALLOCATOR_H
+#define VECTOR_HUGE_PAGE_ALLOCATOR_H
+
+#include <sys/mman.h>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <type_traits>
+
+const size_t kHugePageSize = 2 * 1024 * 1024;
+
+template <class T>
+class HugePageAllocator {
+    static size_t MappingSize(const size_t&);
+
+public:
+    using value_type = T;                    //  NOLINT
+    using is_always_equal = std::true_type;  //  NOLINT
+
+    HugePageAllocator() = default;
+    template <class U>
+    HugePageAllocator(const HugePageAllocator<U>&);  //  NOLINT
+    T* allocate(size_t);                             //  NOLINT
+    void deallocate(T*, size_t);                     //  NOLINT
+    template <class U>
+    bool operator==(const HugePageAllocator<U>&) const;
+    template <class U>
+    bool operator!=(const HugePageAllocator<U>&) const;
+};
+
+template <class T>
+template <class U>
+HugePageAllocator<T>::HugePageAllocator(const HugePageAllocator<U>&) {
+}
+
+template <class T>
+size_t HugePageAllocator<T>::MappingSize(const size_t& n) {
+    return (n * sizeof(T) + kHugePageSize - 1) / kHugePageSize * kHugePageSize;
+}
+
+template <class T>
+T* HugePageAllocator<T>::allocate(size_t n) {  //  NOLINT
+    if (n > static_cast<size_t>(-1) / sizeof(T) - kHugePageSize) {
+        throw std::bad_array_new_length{};
+    }
+    if (n * sizeof(T) < kHugePageSize) {
+        return std::allocator<T>{}.allocate(n);
+    }
+    size_t size = MappingSize(n);
+    void* mapping = mmap(nullptr, size + kHugePageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED) {
+        throw std::bad_alloc{};
+    }
+    auto begin = reinterpret_cast<uintptr_t>(mapping);
+    auto aligned = (begin + kHugePageSize - 1) & ~(kHugePageSize - 1);
+    if (aligned > begin) {
+        munmap(mapping, aligned - begin);
+    }
+    if (aligned + size < begin + size + kHugePageSize) {
+        munmap(reinterpret_cast<void*>(aligned + size), begin + kHugePageSize - aligned);
+    }
+#ifdef MADV_HUGEPAGE
+    madvise(reinterpret_cast<void*>(aligned), size, MADV_HUGEPAGE);
+#endif
+    return reinterpret_cast<T*>(aligned);
+}
+
+template <class T>
+void HugePageAllocator<T>::deallocate(T* pointer, size_t n) {  //  NOLINT
+    if (n * sizeof(T) < kHugePageSize) {
+        std::allocator<T>{}.deallocate(pointer, n);
+        return;
+    }
+    munmap(pointer, MappingSize(n));
+}
+
+template <class T>
+template <class U>
+bool HugePageAllocator<T>::operator==(const HugePageAllocator<U>&) const {
+    return true;
+}
+
+template <class T>
+template <class U>
+bool HugePageAllocator<T>::operator!=(const HugePageAllocator<U>&) const {
+    return false;
+}
+
+#endif  // VECTOR_HUGE_PAGE_ALLOCATOR_H
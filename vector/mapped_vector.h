@@ -0,0 +1,395 @@
+#ifndef VECTOR_MAPPED_VECTOR_H
+#define VECTOR_MAPPED_VECTOR_H
+
+#include "vector.h"
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#include <compare>
+#include <iterator>
+#include <memory>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <utility>
+
+class MappedVectorIoError : public std::runtime_error {
+public:
+    MappedVectorIoError() : std::runtime_error("MappedVectorIoError") {
+    }
+};
+
+const size_t kMappedVectorMinBytes = 4096;
+
+template <class T>
+class MappedVector {
+    static_assert(std::is_trivially_copyable_v<T>, "NotTriviallyCopyable");
+
+    int fd_;
+    T* buffer_;
+    size_t size_;
+    size_t capacity_;
+
+    MappedVector<T>& Remap(const size_t&);
+
+public:
+    using Iterator = T*;
+    using ConstIterator = const T*;
+    using value_type = T;                  //  NOLINT
+    using iterator = Iterator;             //  NOLINT
+    using const_iterator = ConstIterator;  //  NOLINT
+
+    MappedVector();
+    explicit MappedVector(const std::string&);
+    MappedVector(const MappedVector<T>&) = delete;
+    MappedVector<T>& operator=(const MappedVector<T>&) = delete;
+    MappedVector(MappedVector<T>&&) noexcept;
+    MappedVector<T>& operator=(MappedVector<T>&&) noexcept;
+    ~MappedVector();
+    MappedVector<T>& Open(const std::string&);
+    MappedVector<T>& Close();
+    MappedVector<T>& Sync();
+    bool IsOpen() const;
+    MappedVector<T>& Clear();
+    MappedVector<T>& PushBack(const T&);
+    MappedVector<T>& PopBack();
+    MappedVector<T>& Resize(const size_t&);
+    MappedVector<T>& Resize(const size_t&, const T&);
+    MappedVector<T>& Reserve(const size_t&);
+    MappedVector<T>& ShrinkToFit();
+    MappedVector<T>& Swap(MappedVector<T>&);
+    T operator[](const size_t&) const;
+    T& operator[](const size_t&);
+    T At(const size_t&) const;
+    T& At(const size_t&);
+    T Front() const;
+    T& Front();
+    T Back() const;
+    T& Back();
+    bool Empty() const;
+    size_t Size() const;
+    size_t Capacity() const;
+    T* Data() const;
+    Iterator begin();              //  NOLINT
+    Iterator end();                //  NOLINT
+    ConstIterator begin() const;   //  NOLINT
+    ConstIterator end() const;     //  NOLINT
+    ConstIterator cbegin() const;  //  NOLINT
+    ConstIterator cend() const;    //  NOLINT
+    std::weak_ordering operator<=>(const MappedVector<T>&) const;
+    bool operator==(const MappedVector<T>&) const;
+};
+
+template <class T>
+MappedVector<T>::MappedVector() : fd_(-1), buffer_(nullptr), size_(0), capacity_(0) {
+}
+
+template <class T>
+MappedVector<T>::MappedVector(const std::string& path) : MappedVector() {
+    Open(path);
+}
+
+template <class T>
+MappedVector<T>::MappedVector(MappedVector<T>&& vector) noexcept
+    : fd_(vector.fd_), buffer_(vector.buffer_), size_(vector.size_), capacity_(vector.capacity_) {
+    vector.fd_ = -1;
+    vector.buffer_ = nullptr;
+    vector.size_ = vector.capacity_ = 0;
+}
+
+template <class T>
+MappedVector<T>& MappedVector<T>::operator=(MappedVector<T>&& vector) noexcept {
+    if (this != &vector) {
+        try {
+            Close();
+        } catch (const MappedVectorIoError&) {
+        }
+        fd_ = vector.fd_;
+        buffer_ = vector.buffer_;
+        size_ = vector.size_;
+        capacity_ = vector.capacity_;
+        vector.fd_ = -1;
+        vector.buffer_ = nullptr;
+        vector.size_ = vector.capacity_ = 0;
+    }
+    return *this;
+}
+
+template <class T>
+MappedVector<T>::~MappedVector() {
+    try {
+        Close();
+    } catch (const MappedVectorIoError&) {
+    }
+}
+
+template <class T>
+MappedVector<T>& MappedVector<T>::Open(const std::string& path) {
+    Close();
+    int fd = open(path.c_str(), O_RDWR | O_CREAT | O_CLOEXEC, 0644);
+    if (fd < 0) {
+        throw MappedVectorIoError{};
+    }
+    struct stat info {};
+    if (fstat(fd, &info) != 0 || static_cast<size_t>(info.st_size) % sizeof(T) != 0) {
+        close(fd);
+        throw MappedVectorIoError{};
+    }
+    fd_ = fd;
+    size_t size = static_cast<size_t>(info.st_size) / sizeof(T);
+    if (size != 0) {
+        void* mapping = mmap(nullptr, size * sizeof(T), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+        if (mapping == MAP_FAILED) {
+            close(fd_);
+            fd_ = -1;
+            throw MappedVectorIoError{};
+        }
+        buffer_ = static_cast<T*>(mapping);
+    }
+    size_ = capacity_ = size;
+    return *this;
+}
+
+template <class T>
+MappedVector<T>& MappedVector<T>::Close() {
+    if (fd_ < 0) {
+        return *this;
+    }
+    bool failed = false;
+    if (buffer_) {
+        failed |= msync(buffer_, capacity_ * sizeof(T), MS_SYNC) != 0;
+        failed |= munmap(buffer_, capacity_ * sizeof(T)) != 0;
+    }
+    failed |= ftruncate(fd_, static_cast<off_t>(size_ * sizeof(T))) != 0;
+    failed |= close(fd_) != 0;
+    fd_ = -1;
+    buffer_ = nullptr;
+    size_ = capacity_ = 0;
+    if (failed) {
+        throw MappedVectorIoError{};
+    }
+    return *this;
+}
+
+template <class T>
+MappedVector<T>& MappedVector<T>::Sync() {
+    if (buffer_ && msync(buffer_, size_ * sizeof(T), MS_SYNC) != 0) {
+        throw MappedVectorIoError{};
+    }
+    return *this;
+}
+
+template <class T>
+bool MappedVector<T>::IsOpen() const {
+    return fd_ >= 0;
+}
+
+template <class T>
+MappedVector<T>& MappedVector<T>::Remap(const size_t& new_cap) {
+    if (fd_ < 0) {
+        throw MappedVectorIoError{};
+    }
+    if (ftruncate(fd_, static_cast<off_t>(new_cap * sizeof(T))) != 0) {
+        throw MappedVectorIoError{};
+    }
+    void* mapping = nullptr;
+    if (new_cap == 0) {
+        if (buffer_) {
+            munmap(buffer_, capacity_ * sizeof(T));
+        }
+    } else if (buffer_) {
+        mapping = mremap(buffer_, capacity_ * sizeof(T), new_cap * sizeof(T), MREMAP_MAYMOVE);
+    } else {
+        mapping = mmap(nullptr, new_cap * sizeof(T), PROT_READ | PROT_WRITE, MAP_SHARED, fd_, 0);
+    }
+    if (mapping == MAP_FAILED) {
+        ftruncate(fd_, static_cast<off_t>(capacity_ * sizeof(T)));
+        throw MappedVectorIoError{};
+    }
+    buffer_ = static_cast<T*>(mapping);
+    capacity_ = new_cap;
+    return *this;
+}
+
+template <class T>
+MappedVector<T>& MappedVector<T>::Clear() {
+    size_ = 0;
+    return *this;
+}
+
+template <class T>
+MappedVector<T>& MappedVector<T>::PushBack(const T& value) {
+    if (size_ == capacity_) {
+        T copy(value);
+        Remap(Max(capacity_ * 2, (kMappedVectorMinBytes + sizeof(T) - 1) / sizeof(T)));
+        buffer_[size_++] = copy;
+        return *this;
+    }
+    buffer_[size_++] = value;
+    return *this;
+}
+
+template <class T>
+MappedVector<T>& MappedVector<T>::PopBack() {
+    --size_;
+    return *this;
+}
+
+template <class T>
+MappedVector<T>& MappedVector<T>::Resize(const size_t& new_size) {
+    if (new_size > capacity_) {
+        Remap(new_size);
+    }
+    if (new_size > size_) {
+        std::uninitialized_value_construct_n(buffer_ + size_, new_size - size_);
+    }
+    size_ = new_size;
+    return *this;
+}
+
+template <class T>
+MappedVector<T>& MappedVector<T>::Resize(const size_t& new_size, const T& value) {
+    T copy(value);
+    if (new_size > capacity_) {
+        Remap(new_size);
+    }
+    if (new_size > size_) {
+        std::uninitialized_fill_n(buffer_ + size_, new_size - size_, copy);
+    }
+    size_ = new_size;
+    return *this;
+}
+
+template <class T>
+MappedVector<T>& MappedVector<T>::Reserve(const size_t& new_cap) {
+    if (new_cap > capacity_) {
+        Remap(new_cap);
+    }
+    return *this;
+}
+
+template <class T>
+MappedVector<T>& MappedVector<T>::ShrinkToFit() {
+    if (capacity_ > size_) {
+        Remap(size_);
+    }
+    return *this;
+}
+
+template <class T>
+MappedVector<T>& MappedVector<T>::Swap(MappedVector<T>& other) {
+    std::swap(fd_, other.fd_);
+    std::swap(buffer_, other.buffer_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    return *this;
+}
+
+template <class T>
+T& MappedVector<T>::operator[](const size_t& index) {
+    return buffer_[index];
+}
+
+template <class T>
+T MappedVector<T>::operator[](const size_t& index) const {
+    return buffer_[index];
+}
+
+template <class T>
+T& MappedVector<T>::At(const size_t& index) {
+    if (index >= size_) {
+        throw VectorOutOfRange{};
+    }
+    return buffer_[index];
+}
+
+template <class T>
+T MappedVector<T>::At(const size_t& index) const {
+    if (index >= size_) {
+        throw VectorOutOfRange{};
+    }
+    return buffer_[index];
+}
+
+template <class T>
+T& MappedVector<T>::Front() {
+    return buffer_[0];
+}
+
+template <class T>
+T MappedVector<T>::Front() const {
+    return buffer_[0];
+}
+
+template <class T>
+T& MappedVector<T>::Back() {
+    return buffer_[size_ - 1];
+}
+
+template <class T>
+T MappedVector<T>::Back() const {
+    return buffer_[size_ - 1];
+}
+
+template <class T>
+bool MappedVector<T>::Empty() const {
+    return size_ == 0;
+}
+
+template <class T>
+size_t MappedVector<T>::Size() const {
+    return size_;
+}
+
+template <class T>
+size_t MappedVector<T>::Capacity() const {
+    return capacity_;
+}
+
+template <class T>
+T* MappedVector<T>::Data() const {
+    return buffer_;
+}
+
+template <class T>
+typename MappedVector<T>::Iterator MappedVector<T>::begin() {  //  NOLINT
+    return buffer_;
+}
+
+template <class T>
+typename MappedVector<T>::Iterator MappedVector<T>::end() {  //  NOLINT
+    return buffer_ + size_;
+}
+
+template <class T>
+typename MappedVector<T>::ConstIterator MappedVector<T>::begin() const {  //  NOLINT
+    return buffer_;
+}
+
+template <class T>
+typename MappedVector<T>::ConstIterator MappedVector<T>::end() const {  //  NOLINT
+    return buffer_ + size_;
+}
+
+template <class T>
+typename MappedVector<T>::ConstIterator MappedVector<T>::cbegin() const {  //  NOLINT
+    return buffer_;
+}
+
+template <class T>
+typename MappedVector<T>::ConstIterator MappedVector<T>::cend() const {  //  NOLINT
+    return buffer_ + size_;
+}
+
+template <class T>
+std::weak_ordering MappedVector<T>::operator<=>(const MappedVector<T>& other) const {
+    return LexicographicCompare(buffer_, size_, other.buffer_, other.size_);
+}
+
+template <class T>
+bool MappedVector<T>::operator==(const MappedVector<T>& other) const {
+    return RangesEqual(buffer_, size_, other.buffer_, other.size_);
+}
+
+#endif  // VECTOR_MAPPED_VECTOR_H
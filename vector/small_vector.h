@@ -0,0 +1,11 @@
+#ifndef VECTOR_SMALL_VECTOR_H
+#define VECTOR_SMALL_VECTOR_H
+
+#include "vector.h"
+#include <memory>
+
+template <class T, size_t K, class Allocator = std::allocator<T>>
+    requires(K > 0)
+using SmallVector = Vector<T, Allocator, K>;
+
+#endif  // VECTOR_SMALL_VECTOR_H
@@ -0,0 +1,392 @@
+#ifndef VECTOR_SOA_VECTOR_H
+#define VECTOR_SOA_VECTOR_H
+
+#include "vector.h"
+#include <memory>
+#include <span>
+#include <tuple>
+#include <utility>
+
+template <class... Fields>
+class SoaVector {
+    static_assert(sizeof...(Fields) > 0, "NoFields");
+    using Indices = std::index_sequence_for<Fields...>;
+
+    std::tuple<Fields*...> columns_;
+    size_t size_;
+    size_t capacity_;
+
+    template <class Function>
+    void ForEachColumn(Function&&);
+    template <size_t... I>
+    void ConstructRow(const size_t&, std::index_sequence<I...>, const Fields&...);
+    template <size_t... I>
+    void CopyColumns(const SoaVector<Fields...>&, std::index_sequence<I...>);
+    template <class Field>
+    static void RelocateColumn(Field*, const size_t&, Field*);
+    template <class Field>
+    static void ValueConstructColumn(Field*, const size_t&);
+    template <size_t... I>
+    void RelocateColumns(std::tuple<Fields*...>&, std::index_sequence<I...>);
+    template <size_t... I>
+    void ValueConstructRows(const size_t&, const size_t&, std::index_sequence<I...>);
+    void DestroyRows(const size_t&, const size_t&);
+    void Deallocate(std::tuple<Fields*...>&, const size_t&);
+    std::tuple<Fields*...> Allocate(const size_t&);
+
+public:
+    template <size_t I>
+    using FieldType = std::tuple_element_t<I, std::tuple<Fields...>>;
+    using Row = std::tuple<Fields&...>;
+    using ConstRow = std::tuple<const Fields&...>;
+
+    SoaVector();
+    explicit SoaVector(const size_t&);
+    SoaVector(const SoaVector<Fields...>&);
+    SoaVector(SoaVector<Fields...>&&) noexcept;
+    SoaVector<Fields...>& operator=(const SoaVector<Fields...>&);
+    SoaVector<Fields...>& operator=(SoaVector<Fields...>&&) noexcept;
+    ~SoaVector();
+    SoaVector<Fields...>& Clear();
+    SoaVector<Fields...>& PushBack(const Fields&...);
+    SoaVector<Fields...>& PopBack();
+    SoaVector<Fields...>& Resize(const size_t&);
+    SoaVector<Fields...>& Reserve(const size_t&);
+    SoaVector<Fields...>& ShrinkToFit();
+    SoaVector<Fields...>& Swap(SoaVector<Fields...>&);
+    ConstRow operator[](const size_t&) const;
+    Row operator[](const size_t&);
+    ConstRow At(const size_t&) const;
+    Row At(const size_t&);
+    ConstRow Front() const;
+    Row Front();
+    ConstRow Back() const;
+    Row Back();
+    bool Empty() const;
+    size_t Size() const;
+    size_t Capacity() const;
+    template <size_t I>
+    std::span<FieldType<I>> Column();
+    template <size_t I>
+    std::span<const FieldType<I>> Column() const;
+    SoaVector<Fields...>& Realloc(const size_t&);
+};
+
+template <class... Fields>
+template <class Function>
+void SoaVector<Fields...>::ForEachColumn(Function&& function) {
+    std::apply([&](auto*&... columns) { (function(columns), ...); }, columns_);
+}
+
+template <class... Fields>
+std::tuple<Fields*...> SoaVector<Fields...>::Allocate(const size_t& capacity) {
+    std::tuple<Fields*...> columns;
+    std::apply([](auto*&... column) { ((column = nullptr), ...); }, columns);
+    if (capacity == 0) {
+        return columns;
+    }
+    try {
+        std::apply(
+            [&](auto*&... column) {
+                ((column = std::allocator<std::remove_reference_t<decltype(*column)>>{}.allocate(capacity)), ...);
+            },
+            columns);
+    } catch (...) {
+        Deallocate(columns, capacity);
+        throw;
+    }
+    return columns;
+}
+
+template <class... Fields>
+void SoaVector<Fields...>::Deallocate(std::tuple<Fields*...>& columns, const size_t& capacity) {
+    std::apply(
+        [&](auto*&... column) {
+            ((column ? std::allocator<std::remove_reference_t<decltype(*column)>>{}.deallocate(column, capacity)
+                     : void()),
+             ...);
+        },
+        columns);
+}
+
+template <class... Fields>
+void SoaVector<Fields...>::DestroyRows(const size_t& first, const size_t& last) {
+    ForEachColumn([&](auto* column) { std::destroy(column + first, column + last); });
+}
+
+template <class... Fields>
+template <size_t... I>
+void SoaVector<Fields...>::ConstructRow(const size_t& index, std::index_sequence<I...>, const Fields&... values) {
+    size_t constructed = 0;
+    try {
+        ((std::construct_at(std::get<I>(columns_) + index, values), ++constructed), ...);
+    } catch (...) {
+        ((I < constructed ? std::destroy_at(std::get<I>(columns_) + index) : void()), ...);
+        throw;
+    }
+}
+
+template <class... Fields>
+template <size_t... I>
+void SoaVector<Fields...>::CopyColumns(const SoaVector<Fields...>& other, std::index_sequence<I...>) {
+    size_t copied = 0;
+    try {
+        ((std::uninitialized_copy_n(std::get<I>(other.columns_), other.size_, std::get<I>(columns_)), ++copied),
+         ...);
+    } catch (...) {
+        ((I < copied ? static_cast<void>(std::destroy_n(std::get<I>(columns_), other.size_)) : void()), ...);
+        throw;
+    }
+}
+
+template <class... Fields>
+template <class Field>
+void SoaVector<Fields...>::RelocateColumn(Field* from, const size_t& count, Field* to) {
+    std::allocator<Field> allocator;
+    UninitializedRelocate(allocator, from, count, to);
+}
+
+template <class... Fields>
+template <class Field>
+void SoaVector<Fields...>::ValueConstructColumn(Field* first, const size_t& count) {
+    std::allocator<Field> allocator;
+    UninitializedValueConstruct(allocator, first, count);
+}
+
+template <class... Fields>
+template <size_t... I>
+void SoaVector<Fields...>::ValueConstructRows(const size_t& first, const size_t& count, std::index_sequence<I...>) {
+    size_t constructed = 0;
+    try {
+        ((ValueConstructColumn(std::get<I>(columns_) + first, count), ++constructed), ...);
+    } catch (...) {
+        ((I < constructed ? static_cast<void>(std::destroy_n(std::get<I>(columns_) + first, count)) : void()), ...);
+        throw;
+    }
+}
+
+template <class... Fields>
+template <size_t... I>
+void SoaVector<Fields...>::RelocateColumns(std::tuple<Fields*...>& columns, std::index_sequence<I...>) {
+    size_t relocated = 0;
+    try {
+        ((RelocateColumn(std::get<I>(columns_), size_, std::get<I>(columns)), ++relocated), ...);
+    } catch (...) {
+        ((I < relocated ? static_cast<void>(std::destroy_n(std::get<I>(columns), size_)) : void()), ...);
+        throw;
+    }
+}
+
+template <class... Fields>
+SoaVector<Fields...>::SoaVector() : columns_(Allocate(0)), size_(0), capacity_(0) {
+}
+
+template <class... Fields>
+SoaVector<Fields...>::SoaVector(const size_t& size) : SoaVector() {
+    Resize(size);
+}
+
+template <class... Fields>
+SoaVector<Fields...>::SoaVector(const SoaVector<Fields...>& vector)
+    : columns_(Allocate(vector.capacity_)), size_(0), capacity_(vector.capacity_) {
+    try {
+        CopyColumns(vector, Indices{});
+    } catch (...) {
+        Deallocate(columns_, capacity_);
+        throw;
+    }
+    size_ = vector.size_;
+}
+
+template <class... Fields>
+SoaVector<Fields...>::SoaVector(SoaVector<Fields...>&& vector) noexcept
+    : columns_(vector.columns_), size_(vector.size_), capacity_(vector.capacity_) {
+    vector.columns_ = Allocate(0);
+    vector.size_ = vector.capacity_ = 0;
+}
+
+template <class... Fields>
+SoaVector<Fields...>& SoaVector<Fields...>::operator=(const SoaVector<Fields...>& vector) {
+    if (this != &vector) {
+        SoaVector<Fields...> copy(vector);
+        Swap(copy);
+    }
+    return *this;
+}
+
+template <class... Fields>
+SoaVector<Fields...>& SoaVector<Fields...>::operator=(SoaVector<Fields...>&& vector) noexcept {
+    if (this != &vector) {
+        Clear();
+        Deallocate(columns_, capacity_);
+        columns_ = vector.columns_;
+        size_ = vector.size_;
+        capacity_ = vector.capacity_;
+        vector.columns_ = Allocate(0);
+        vector.size_ = vector.capacity_ = 0;
+    }
+    return *this;
+}
+
+template <class... Fields>
+SoaVector<Fields...>::~SoaVector() {
+    DestroyRows(0, size_);
+    Deallocate(columns_, capacity_);
+}
+
+template <class... Fields>
+SoaVector<Fields...>& SoaVector<Fields...>::Realloc(const size_t& new_cap) {
+    std::tuple<Fields*...> columns = Allocate(new_cap);
+    try {
+        RelocateColumns(columns, Indices{});
+    } catch (...) {
+        Deallocate(columns, new_cap);
+        throw;
+    }
+    DestroyRows(0, size_);
+    Deallocate(columns_, capacity_);
+    columns_ = columns;
+    capacity_ = new_cap;
+    return *this;
+}
+
+template <class... Fields>
+SoaVector<Fields...>& SoaVector<Fields...>::Clear() {
+    DestroyRows(0, size_);
+    size_ = 0;
+    return *this;
+}
+
+template <class... Fields>
+SoaVector<Fields...>& SoaVector<Fields...>::PushBack(const Fields&... values) {
+    if (size_ == capacity_) {
+        std::tuple<Fields...> copy(values...);
+        this->Realloc((capacity_ + (capacity_ == 0)) * 2);
+        std::apply([&](const Fields&... fields) { ConstructRow(size_, Indices{}, fields...); }, copy);
+    } else {
+        ConstructRow(size_, Indices{}, values...);
+    }
+    ++size_;
+    return *this;
+}
+
+template <class... Fields>
+SoaVector<Fields...>& SoaVector<Fields...>::PopBack() {
+    --size_;
+    DestroyRows(size_, size_ + 1);
+    return *this;
+}
+
+template <class... Fields>
+SoaVector<Fields...>& SoaVector<Fields...>::Resize(const size_t& new_size) {
+    if (new_size > capacity_) {
+        this->Realloc(new_size);
+    }
+    if (new_size < size_) {
+        DestroyRows(new_size, size_);
+        size_ = new_size;
+        return *this;
+    }
+    ValueConstructRows(size_, new_size - size_, Indices{});
+    size_ = new_size;
+    return *this;
+}
+
+template <class... Fields>
+SoaVector<Fields...>& SoaVector<Fields...>::Reserve(const size_t& new_cap) {
+    if (new_cap > capacity_) {
+        this->Realloc(new_cap);
+    }
+    return *this;
+}
+
+template <class... Fields>
+SoaVector<Fields...>& SoaVector<Fields...>::ShrinkToFit() {
+    if (capacity_ > size_) {
+        this->Realloc(size_);
+    }
+    return *this;
+}
+
+template <class... Fields>
+SoaVector<Fields...>& SoaVector<Fields...>::Swap(SoaVector<Fields...>& other) {
+    std::swap(columns_, other.columns_);
+    std::swap(size_, other.size_);
+    std::swap(capacity_, other.capacity_);
+    return *this;
+}
+
+template <class... Fields>
+typename SoaVector<Fields...>::Row SoaVector<Fields...>::operator[](const size_t& index) {
+    return std::apply([&](Fields*... columns) { return Row(columns[index]...); }, columns_);
+}
+
+template <class... Fields>
+typename SoaVector<Fields...>::ConstRow SoaVector<Fields...>::operator[](const size_t& index) const {
+    return std::apply([&](Fields*... columns) { return ConstRow(columns[index]...); }, columns_);
+}
+
+template <class... Fields>
+typename SoaVector<Fields...>::Row SoaVector<Fields...>::At(const size_t& index) {
+    if (index >= size_) {
+        throw VectorOutOfRange{};
+    }
+    return (*this)[index];
+}
+
+template <class... Fields>
+typename SoaVector<Fields...>::ConstRow SoaVector<Fields...>::At(const size_t& index) const {
+    if (index >= size_) {
+        throw VectorOutOfRange{};
+    }
+    return (*this)[index];
+}
+
+template <class... Fields>
+typename SoaVector<Fields...>::Row SoaVector<Fields...>::Front() {
+    return (*this)[0];
+}
+
+template <class... Fields>
+typename SoaVector<Fields...>::ConstRow SoaVector<Fields...>::Front() const {
+    return (*this)[0];
+}
+
+template <class... Fields>
+typename SoaVector<Fields...>::Row SoaVector<Fields...>::Back() {
+    return (*this)[size_ - 1];
+}
+
+template <class... Fields>
+typename SoaVector<Fields...>::ConstRow SoaVector<Fields...>::Back() const {
+    return (*this)[size_ - 1];
+}
+
+template <class... Fields>
+bool SoaVector<Fields...>::Empty() const {
+    return size_ == 0;
+}
+
+template <class... Fields>
+size_t SoaVector<Fields...>::Size() const {
+    return size_;
+}
+
+template <class... Fields>
+size_t SoaVector<Fields...>::Capacity() const {
+    return capacity_;
+}
+
+template <class... Fields>
+template <size_t I>
+std::span<typename SoaVector<Fields...>::template FieldType<I>> SoaVector<Fields...>::Column() {
+    return {std::get<I>(columns_), size_};
+}
+
+template <class... Fields>
+template <size_t I>
+std::span<const typename SoaVector<Fields...>::template FieldType<I>> SoaVector<Fields...>::Column() const {
+    return {std::get<I>(columns_), size_};
+}
+
+#endif  // VECTOR_SOA_VECTOR_H
@@ -1,9 +1,17 @@
 #ifndef VECTOR_VECTOR_H
 #define VECTOR_VECTOR_H
 
+#include <util/compare.h>
+#include <algorithm>
+#include <compare>
+#include <cstring>
 #include <exception>
 #include <iomanip>
 #include <iostream>
+#include <iterator>
+#include <memory>
+#include <type_traits>
+#include <utility>
 
 class VectorOutOfRange : public std::out_of_range {
 public:
@@ -12,28 +20,173 @@ public:
 };
 
 template <class T>
+T Max(T f, T s) {
+    T max = f;
+    if (f < s) {
+        max = s;
+    }
+    return max;
+}
+
+template <class It>
+concept MultiPassIterator =
+    std::forward_iterator<It> ||
+    std::derived_from<typename std::iterator_traits<It>::iterator_category, std::forward_iterator_tag>;
+
+template <class Allocator, class T, class... Args>
+concept HasCustomConstruct = requires(Allocator& allocator, T* pointer, Args&&... args) {
+    allocator.construct(pointer, std::forward<Args>(args)...);
+};
+
+template <class T, class Allocator>
+void UninitializedFill(Allocator& allocator, T* first, const size_t& count, const T& value) {
+    if constexpr (!HasCustomConstruct<Allocator, T, const T&>) {
+        std::uninitialized_fill_n(first, count, value);
+    } else {
+        size_t i = 0;
+        try {
+            for (; i < count; ++i) {
+                std::allocator_traits<Allocator>::construct(allocator, first + i, value);
+            }
+        } catch (...) {
+            for (size_t j = 0; j < i; ++j) {
+                std::allocator_traits<Allocator>::destroy(allocator, first + j);
+            }
+            throw;
+        }
+    }
+}
+
+template <class T, class Allocator>
+void UninitializedValueConstruct(Allocator& allocator, T* first, const size_t& count) {
+    if constexpr (!HasCustomConstruct<Allocator, T>) {
+        std::uninitialized_value_construct_n(first, count);
+    } else {
+        size_t i = 0;
+        try {
+            for (; i < count; ++i) {
+                std::allocator_traits<Allocator>::construct(allocator, first + i);
+            }
+        } catch (...) {
+            for (size_t j = 0; j < i; ++j) {
+                std::allocator_traits<Allocator>::destroy(allocator, first + j);
+            }
+            throw;
+        }
+    }
+}
+
+// Leaves trivial elements uninitialized unless the allocator customizes construct, which then gets the call as for
+// value-initialization.
+template <class T, class Allocator>
+void UninitializedDefaultConstruct(Allocator& allocator, T* first, const size_t& count) {
+    if constexpr (!HasCustomConstruct<Allocator, T>) {
+        std::uninitialized_default_construct_n(first, count);
+    } else {
+        UninitializedValueConstruct(allocator, first, count);
+    }
+}
+
+// Moves (or copies, if the move may throw) count elements into uninitialized memory; the source is left
+// for the caller to destroy.
+template <class T, class Allocator>
+void UninitializedRelocate(Allocator& allocator, T* from, const size_t& count, T* to) {
+    if constexpr (std::is_trivially_copyable_v<T> && !HasCustomConstruct<Allocator, T, T&&> &&
+                  !HasCustomConstruct<Allocator, T, const T&>) {
+        if (count != 0) {
+            std::memcpy(static_cast<void*>(to), static_cast<const void*>(from), count * sizeof(T));
+        }
+    } else {
+        size_t i = 0;
+        try {
+            for (; i < count; ++i) {
+                std::allocator_traits<Allocator>::construct(allocator, to + i, std::move_if_noexcept(from[i]));
+            }
+        } catch (...) {
+            for (size_t j = 0; j < i; ++j) {
+                std::allocator_traits<Allocator>::destroy(allocator, to + j);
+            }
+            throw;
+        }
+    }
+}
+
+// Storage for up to K elements inside the container object; empty for K == 0.
+template <class T, size_t K>
+class InlineStorage {
+    alignas(T) unsigned char storage_[K * sizeof(T)];
+
+public:
+    T* Data() {
+        return reinterpret_cast<T*>(storage_);
+    }
+    const T* Data() const {
+        return reinterpret_cast<const T*>(storage_);
+    }
+};
+
+template <class T>
+class InlineStorage<T, 0> {
+public:
+    T* Data() {
+        return nullptr;
+    }
+    const T* Data() const {
+        return nullptr;
+    }
+};
+
+// K > 0 keeps up to K elements in InlineStorage and only then goes to the allocator (see SmallVector); the capacity
+// never drops below K, and the inline buffer takes the place of the null one of a plain Vector.
+template <class T, class Allocator = std::allocator<T>, size_t K = 0>
 class Vector {
+    using AllocatorTraits = std::allocator_traits<Allocator>;
+    static constexpr bool kMoveIsNoexcept = K == 0 || std::is_nothrow_move_constructible_v<T>;
+    static constexpr bool kMoveAssignIsNoexcept =
+        kMoveIsNoexcept && (AllocatorTraits::propagate_on_container_move_assignment::value ||
+                            AllocatorTraits::is_always_equal::value);
+
     T* buffer_;
     size_t size_;
     size_t capacity_;
+    [[no_unique_address]] Allocator allocator_;
+    [[no_unique_address]] InlineStorage<T, K> inline_;
+
+    bool OnHeap() const;
+    T* Allocate(const size_t&);
+    void Deallocate(T*, const size_t&);
+    void Destroy(T*, T*);
+    void UninitializedCopy(const T*, const size_t&, T*);
+    void Release();
+    Vector<T, Allocator, K>& Steal(Vector<T, Allocator, K>&&);
 
 public:
+    using AllocatorType = Allocator;
+    using Iterator = T*;
+    using ConstIterator = const T*;
+    using value_type = T;                  //  NOLINT
+    using iterator = Iterator;             //  NOLINT
+    using const_iterator = ConstIterator;  //  NOLINT
+
     Vector();
-    explicit Vector(const size_t&);
-    Vector(const size_t&, T);
-    Vector(const Vector<T>&);
-    Vector(Vector<T>&&) noexcept;
-    Vector<T>& operator=(Vector<T>&&) noexcept;
-    Vector<T>& operator=(const Vector<T>&);
+    explicit Vector(const Allocator&);
+    explicit Vector(const size_t&, const Allocator& = Allocator());
+    Vector(const size_t&, T, const Allocator& = Allocator());
+    Vector(const Vector<T, Allocator, K>&);
+    Vector(Vector<T, Allocator, K>&&) noexcept(kMoveIsNoexcept);
+    Vector<T, Allocator, K>& operator=(Vector<T, Allocator, K>&&) noexcept(kMoveAssignIsNoexcept);
+    Vector<T, Allocator, K>& operator=(const Vector<T, Allocator, K>&);
     ~Vector();
-    Vector<T>& Clear();
-    Vector<T>& PushBack(const T&);
-    Vector<T>& PopBack();
-    Vector<T>& Resize(const size_t&);
-    Vector<T>& Resize(const size_t&, const T&);
-    Vector<T>& Reserve(const size_t&);
-    Vector<T>& ShrinkToFit();
-    Vector<T>& Swap(Vector<T>&);
+    Vector<T, Allocator, K>& Clear();
+    Vector<T, Allocator, K>& PushBack(const T&);
+    Vector<T, Allocator, K>& PopBack();
+    Vector<T, Allocator, K>& Resize(const size_t&);
+    Vector<T, Allocator, K>& Resize(const size_t&, const T&);
+    Vector<T, Allocator, K>& ResizeUninitialized(const size_t&);
+    Vector<T, Allocator, K>& ResizeForOverwrite(const size_t&);
+    Vector<T, Allocator, K>& Reserve(const size_t&);
+    Vector<T, Allocator, K>& ShrinkToFit();
+    Vector<T, Allocator, K>& Swap(Vector<T, Allocator, K>&);
     T operator[](const size_t&) const;
     T& operator[](const size_t&);
     T At(const size_t&) const;
@@ -43,310 +196,615 @@ public:
     T Back() const;
     T& Back();
     bool Empty() const;
+    bool IsInline() const
+        requires(K > 0);
     size_t Size() const;
     size_t Capacity() const;
     T* Data() const;
-    bool operator>(const Vector<T>&) const;
-    bool operator<(const Vector<T>&) const;
-    bool operator>=(const Vector<T>&) const;
-    bool operator<=(const Vector<T>&) const;
-    bool operator==(const Vector<T>&) const;
-    bool operator!=(const Vector<T>&) const;
-    Vector<T>& Realloc();
+    Allocator GetAllocator() const;
+    Iterator begin();                                     //  NOLINT
+    Iterator end();                                       //  NOLINT
+    ConstIterator begin() const;                          //  NOLINT
+    ConstIterator end() const;                            //  NOLINT
+    ConstIterator cbegin() const;                         //  NOLINT
+    ConstIterator cend() const;                           //  NOLINT
+    std::reverse_iterator<Iterator> rbegin();             //  NOLINT
+    std::reverse_iterator<Iterator> rend();               //  NOLINT
+    std::reverse_iterator<ConstIterator> rbegin() const;  //  NOLINT
+    std::reverse_iterator<ConstIterator> rend() const;    //  NOLINT
+    Iterator Insert(ConstIterator, const T&);
+    template <std::input_iterator InputIt>
+    Iterator Insert(ConstIterator, InputIt, InputIt);
+    Iterator Erase(ConstIterator);
+    Iterator Erase(ConstIterator, ConstIterator);
+    template <std::input_iterator InputIt>
+    Vector<T, Allocator, K>& Assign(InputIt, InputIt);
+    std::weak_ordering operator<=>(const Vector<T, Allocator, K>&) const;
+    bool operator>(const Vector<T, Allocator, K>&) const;
+    bool operator<(const Vector<T, Allocator, K>&) const;
+    bool operator>=(const Vector<T, Allocator, K>&) const;
+    bool operator<=(const Vector<T, Allocator, K>&) const;
+    bool operator==(const Vector<T, Allocator, K>&) const;
+    bool operator!=(const Vector<T, Allocator, K>&) const;
+    Vector<T, Allocator, K>& Realloc(const size_t&);
 };
 
-template <class T>
-Vector<T>::Vector() {
-    buffer_ = nullptr;
-    size_ = 0;
-    capacity_ = 0;
+template <class T, class Allocator, size_t K>
+bool Vector<T, Allocator, K>::OnHeap() const {
+    return buffer_ != inline_.Data();
 }
 
-template <class T>
-Vector<T>::Vector(const size_t& size) {
-    buffer_ = new T[size];
-    size_ = size;
-    capacity_ = size;
+template <class T, class Allocator, size_t K>
+T* Vector<T, Allocator, K>::Allocate(const size_t& capacity) {
+    if (capacity <= K) {
+        return inline_.Data();
+    }
+    return AllocatorTraits::allocate(allocator_, capacity);
 }
 
-template <class T>
-Vector<T>::Vector(const size_t& size, T value) {
-    buffer_ = new T[size];
-    size_ = size;
-    capacity_ = size;
-    for (size_t i = 0; i < size_; ++i) {
-        buffer_[i] = value;
+template <class T, class Allocator, size_t K>
+void Vector<T, Allocator, K>::Deallocate(T* buffer, const size_t& capacity) {
+    if (buffer != inline_.Data()) {
+        AllocatorTraits::deallocate(allocator_, buffer, capacity);
     }
 }
 
-template <class T>
-Vector<T>::Vector(const Vector<T>& vector) {
-    size_ = vector.size_;
-    capacity_ = vector.capacity_;
-    buffer_ = new T[capacity_];
-    for (size_t i = 0; i < size_; ++i) {
-        buffer_[i] = vector.buffer_[i];
+template <class T, class Allocator, size_t K>
+void Vector<T, Allocator, K>::Destroy(T* first, T* last) {
+    for (; first != last; ++first) {
+        AllocatorTraits::destroy(allocator_, first);
     }
 }
 
-template <class T>
-Vector<T>::Vector(Vector<T>&& vector) noexcept
-    : buffer_(vector.buffer_), size_(vector.size_), capacity_(vector.capacity_) {
-    vector.size_ = vector.capacity_ = 0;
-    vector.buffer_ = nullptr;
+template <class T, class Allocator, size_t K>
+void Vector<T, Allocator, K>::UninitializedCopy(const T* from, const size_t& count, T* to) {
+    size_t i = 0;
+    try {
+        for (; i < count; ++i) {
+            AllocatorTraits::construct(allocator_, to + i, from[i]);
+        }
+    } catch (...) {
+        Destroy(to, to + i);
+        throw;
+    }
 }
 
-template <class T>
-Vector<T>& Vector<T>::operator=(const Vector<T>& vector) {
-    if (this == &vector) {
+template <class T, class Allocator, size_t K>
+void Vector<T, Allocator, K>::Release() {
+    Destroy(buffer_, buffer_ + size_);
+    Deallocate(buffer_, capacity_);
+    buffer_ = inline_.Data();
+    size_ = 0;
+    capacity_ = K;
+}
+
+// Expects *this to be released. A heap buffer is taken over as is, inline elements (at most K) are moved one by one.
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>& Vector<T, Allocator, K>::Steal(Vector<T, Allocator, K>&& other) {
+    if (other.OnHeap()) {
+        buffer_ = other.buffer_;
+        size_ = other.size_;
+        capacity_ = other.capacity_;
+        other.buffer_ = other.inline_.Data();
+        other.size_ = 0;
+        other.capacity_ = K;
         return *this;
     }
-    delete[] buffer_;
-    size_ = vector.size_;
-    capacity_ = vector.capacity_;
-    buffer_ = new T[capacity_];
-    for (size_t i = 0; i < size_; ++i) {
-        buffer_[i] = vector.buffer_[i];
+    for (; size_ < other.size_; ++size_) {
+        AllocatorTraits::construct(allocator_, buffer_ + size_, std::move(other.buffer_[size_]));
     }
+    other.Clear();
     return *this;
 }
 
-template <class T>
-Vector<T>& Vector<T>::operator=(Vector<T>&& vector) noexcept {
-    if (this != &vector) {
-        delete[] buffer_;
-        size_ = vector.size_;
-        capacity_ = vector.capacity_;
-        buffer_ = vector.buffer_;
-        vector.size_ = vector.capacity_ = 0;
-        vector.buffer_ = nullptr;
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>::Vector() : Vector(Allocator()) {
+}
+
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>::Vector(const Allocator& allocator)
+    : size_(0), capacity_(K), allocator_(allocator) {
+    buffer_ = inline_.Data();
+}
+
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>::Vector(const size_t& size, const Allocator& allocator) : Vector(allocator) {
+    Resize(size);
+}
+
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>::Vector(const size_t& size, T value, const Allocator& allocator) : Vector(allocator) {
+    Resize(size, value);
+}
+
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>::Vector(const Vector<T, Allocator, K>& vector)
+    : Vector(AllocatorTraits::select_on_container_copy_construction(vector.allocator_)) {
+    Reserve(vector.capacity_);
+    UninitializedCopy(vector.buffer_, vector.size_, buffer_);
+    size_ = vector.size_;
+}
+
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>::Vector(Vector<T, Allocator, K>&& vector) noexcept(kMoveIsNoexcept)
+    : Vector(vector.allocator_) {
+    Steal(std::move(vector));
+}
+
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>& Vector<T, Allocator, K>::operator=(const Vector<T, Allocator, K>& vector) {
+    if (this == &vector) {
+        return *this;
     }
+    Release();
+    if constexpr (AllocatorTraits::propagate_on_container_copy_assignment::value) {
+        allocator_ = vector.allocator_;
+    }
+    Reserve(vector.capacity_);
+    UninitializedCopy(vector.buffer_, vector.size_, buffer_);
+    size_ = vector.size_;
     return *this;
 }
 
-template <class T>
-Vector<T>::~Vector() {
-    if (buffer_) {
-        delete[] buffer_;
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>& Vector<T, Allocator, K>::operator=(Vector<T, Allocator, K>&& vector) noexcept(
+    kMoveAssignIsNoexcept) {
+    if (this == &vector) {
+        return *this;
+    }
+    if constexpr (!AllocatorTraits::propagate_on_container_move_assignment::value &&
+                  !AllocatorTraits::is_always_equal::value) {
+        if (allocator_ != vector.allocator_ && vector.OnHeap()) {
+            Clear();
+            Reserve(vector.size_);
+            for (; size_ < vector.size_; ++size_) {
+                AllocatorTraits::construct(allocator_, buffer_ + size_, std::move(vector.buffer_[size_]));
+            }
+            vector.Clear();
+            return *this;
+        }
+    }
+    Release();
+    if constexpr (AllocatorTraits::propagate_on_container_move_assignment::value) {
+        allocator_ = std::move(vector.allocator_);
     }
+    return Steal(std::move(vector));
 }
 
-template <class T>
-Vector<T>& Vector<T>::Clear() {
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>::~Vector() {
+    Destroy(buffer_, buffer_ + size_);
+    Deallocate(buffer_, capacity_);
+}
+
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>& Vector<T, Allocator, K>::Clear() {
+    Destroy(buffer_, buffer_ + size_);
     size_ = 0;
     return *this;
 }
 
-template <class T>
-Vector<T>& Vector<T>::Realloc() {
-    T* buffer = new T[capacity_];
-    for (size_t i = 0; i < size_; ++i) {
-        buffer[i] = buffer_[i];
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>& Vector<T, Allocator, K>::Realloc(const size_t& new_cap) {
+    T* buffer = Allocate(new_cap);
+    if (buffer == buffer_) {
+        return *this;
+    }
+    try {
+        UninitializedRelocate(allocator_, buffer_, size_, buffer);
+    } catch (...) {
+        Deallocate(buffer, new_cap);
+        throw;
     }
-    delete[] buffer_;
+    Destroy(buffer_, buffer_ + size_);
+    Deallocate(buffer_, capacity_);
     buffer_ = buffer;
+    capacity_ = Max(K, new_cap);
     return *this;
 }
 
-template <class T>
-Vector<T>& Vector<T>::PushBack(const T& value) {
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>& Vector<T, Allocator, K>::PushBack(const T& value) {
     if (size_ == capacity_) {
-        capacity_ += (capacity_ == 0);
-        capacity_ *= 2;
-        this->Realloc();
+        T copy(value);
+        this->Realloc((capacity_ + (capacity_ == 0)) * 2);
+        AllocatorTraits::construct(allocator_, buffer_ + size_, std::move(copy));
+    } else {
+        AllocatorTraits::construct(allocator_, buffer_ + size_, value);
     }
-    buffer_[size_++] = value;
+    ++size_;
     return *this;
 }
 
-template <class T>
-Vector<T>& Vector<T>::PopBack() {
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>& Vector<T, Allocator, K>::PopBack() {
     --size_;
+    AllocatorTraits::destroy(allocator_, buffer_ + size_);
     return *this;
 }
 
-template <class T>
-Vector<T>& Vector<T>::Resize(const size_t& new_size) {
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>& Vector<T, Allocator, K>::Resize(const size_t& new_size) {
     if (new_size > capacity_) {
-        capacity_ = new_size;
-        this->Realloc();
+        this->Realloc(new_size);
+    }
+    if (new_size < size_) {
+        Destroy(buffer_ + new_size, buffer_ + size_);
+    } else {
+        UninitializedValueConstruct(allocator_, buffer_ + size_, new_size - size_);
     }
     size_ = new_size;
     return *this;
 }
 
-template <class T>
-Vector<T>& Vector<T>::Resize(const size_t& new_size, const T& value) {
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>& Vector<T, Allocator, K>::Resize(const size_t& new_size, const T& value) {
+    if (new_size < size_) {
+        Destroy(buffer_ + new_size, buffer_ + size_);
+        size_ = new_size;
+        return *this;
+    }
     if (new_size > capacity_) {
-        capacity_ = new_size;
-        this->Realloc();
+        T copy(value);
+        this->Realloc(new_size);
+        UninitializedFill(allocator_, buffer_ + size_, new_size - size_, copy);
+    } else {
+        UninitializedFill(allocator_, buffer_ + size_, new_size - size_, value);
     }
-    if (new_size > size_) {
-        for (; size_ < new_size;) {
-            buffer_[size_] = value;
-            ++size_;
-        }
+    size_ = new_size;
+    return *this;
+}
+
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>& Vector<T, Allocator, K>::ResizeUninitialized(const size_t& new_size) {
+    static_assert(std::is_trivially_default_constructible_v<T> && std::is_trivially_destructible_v<T>,
+                  "NotTrivialType");
+    if (new_size > capacity_) {
+        this->Realloc(new_size);
+    }
+    size_ = new_size;
+    return *this;
+}
+
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>& Vector<T, Allocator, K>::ResizeForOverwrite(const size_t& new_size) {
+    if (new_size > capacity_) {
+        this->Realloc(new_size);
+    }
+    if (new_size < size_) {
+        Destroy(buffer_ + new_size, buffer_ + size_);
     } else {
-        size_ = new_size;
+        UninitializedDefaultConstruct(allocator_, buffer_ + size_, new_size - size_);
     }
+    size_ = new_size;
     return *this;
 }
 
-template <class T>
-Vector<T>& Vector<T>::Reserve(const size_t& new_cap) {
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>& Vector<T, Allocator, K>::Reserve(const size_t& new_cap) {
     if (new_cap > capacity_) {
-        capacity_ = new_cap;
-        this->Realloc();
+        this->Realloc(new_cap);
     }
     return *this;
 }
 
-template <class T>
-Vector<T>& Vector<T>::ShrinkToFit() {
-    if (capacity_ > size_) {
-        capacity_ = size_;
-        this->Realloc();
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>& Vector<T, Allocator, K>::ShrinkToFit() {
+    if (capacity_ > size_ && OnHeap()) {
+        this->Realloc(size_);
     }
     return *this;
 }
 
-template <class T>
-Vector<T>& Vector<T>::Swap(Vector<T>& other) {
-    Vector<T> tmp(std::move(*this));
+template <class T, class Allocator, size_t K>
+Vector<T, Allocator, K>& Vector<T, Allocator, K>::Swap(Vector<T, Allocator, K>& other) {
+    if (this == &other) {
+        return *this;
+    }
+    if (K == 0 || (OnHeap() && other.OnHeap())) {
+        std::swap(buffer_, other.buffer_);
+        std::swap(size_, other.size_);
+        std::swap(capacity_, other.capacity_);
+        if constexpr (AllocatorTraits::propagate_on_container_swap::value) {
+            std::swap(allocator_, other.allocator_);
+        }
+        return *this;
+    }
+    Vector<T, Allocator, K> tmp(std::move(*this));
     *this = std::move(other);
     other = std::move(tmp);
     return *this;
 }
 
-template <class T>
-T& Vector<T>::operator[](const size_t& index) {
+template <class T, class Allocator, size_t K>
+T& Vector<T, Allocator, K>::operator[](const size_t& index) {
     return buffer_[index];
 }
 
-template <class T>
-T Vector<T>::operator[](const size_t& index) const {
+template <class T, class Allocator, size_t K>
+T Vector<T, Allocator, K>::operator[](const size_t& index) const {
     return buffer_[index];
 }
 
-template <class T>
-T& Vector<T>::At(const size_t& index) {
+template <class T, class Allocator, size_t K>
+T& Vector<T, Allocator, K>::At(const size_t& index) {
     if (index >= size_) {
         throw VectorOutOfRange{};
     }
     return buffer_[index];
 }
 
-template <class T>
-T Vector<T>::At(const size_t& index) const {
+template <class T, class Allocator, size_t K>
+T Vector<T, Allocator, K>::At(const size_t& index) const {
     if (index >= size_) {
         throw VectorOutOfRange{};
     }
     return buffer_[index];
 }
 
-template <class T>
-T& Vector<T>::Front() {
+template <class T, class Allocator, size_t K>
+T& Vector<T, Allocator, K>::Front() {
     return buffer_[0];
 }
 
-template <class T>
-T Vector<T>::Front() const {
+template <class T, class Allocator, size_t K>
+T Vector<T, Allocator, K>::Front() const {
     return buffer_[0];
 }
 
-template <class T>
-T& Vector<T>::Back() {
+template <class T, class Allocator, size_t K>
+T& Vector<T, Allocator, K>::Back() {
     return buffer_[size_ - 1];
 }
 
-template <class T>
-T Vector<T>::Back() const {
+template <class T, class Allocator, size_t K>
+T Vector<T, Allocator, K>::Back() const {
     return buffer_[size_ - 1];
 }
 
-template <class T>
-bool Vector<T>::Empty() const {
+template <class T, class Allocator, size_t K>
+bool Vector<T, Allocator, K>::Empty() const {
     return size_ == 0;
 }
 
-template <class T>
-size_t Vector<T>::Size() const {
+template <class T, class Allocator, size_t K>
+bool Vector<T, Allocator, K>::IsInline() const
+    requires(K > 0)
+{
+    return !OnHeap();
+}
+
+template <class T, class Allocator, size_t K>
+size_t Vector<T, Allocator, K>::Size() const {
     return size_;
 }
 
-template <class T>
-size_t Vector<T>::Capacity() const {
+template <class T, class Allocator, size_t K>
+size_t Vector<T, Allocator, K>::Capacity() const {
     return capacity_;
 }
 
-template <class T>
-T* Vector<T>::Data() const {
+template <class T, class Allocator, size_t K>
+T* Vector<T, Allocator, K>::Data() const {
     return buffer_;
 }
 
-template <class T>
-T Max(T f, T s) {
-    T max = f;
-    if (f < s) {
-        max = s;
-    }
-    return max;
+template <class T, class Allocator, size_t K>
+Allocator Vector<T, Allocator, K>::GetAllocator() const {
+    return allocator_;
 }
 
-template <class T>
-bool Vector<T>::operator>(const Vector<T>& other) const {
-    size_t size = Max(size_, other.size_);
-    for (size_t i = 0; i < size; ++i) {
-        if (i < size_ && i < other.size_) {
-            if (buffer_[i] > other.buffer_[i]) {
-                return true;
+template <class T, class Allocator, size_t K>
+typename Vector<T, Allocator, K>::Iterator Vector<T, Allocator, K>::begin() {  //  NOLINT
+    return buffer_;
+}
+
+template <class T, class Allocator, size_t K>
+typename Vector<T, Allocator, K>::Iterator Vector<T, Allocator, K>::end() {  //  NOLINT
+    return buffer_ + size_;
+}
+
+template <class T, class Allocator, size_t K>
+typename Vector<T, Allocator, K>::ConstIterator Vector<T, Allocator, K>::begin() const {  //  NOLINT
+    return buffer_;
+}
+
+template <class T, class Allocator, size_t K>
+typename Vector<T, Allocator, K>::ConstIterator Vector<T, Allocator, K>::end() const {  //  NOLINT
+    return buffer_ + size_;
+}
+
+template <class T, class Allocator, size_t K>
+typename Vector<T, Allocator, K>::ConstIterator Vector<T, Allocator, K>::cbegin() const {  //  NOLINT
+    return buffer_;
+}
+
+template <class T, class Allocator, size_t K>
+typename Vector<T, Allocator, K>::ConstIterator Vector<T, Allocator, K>::cend() const {  //  NOLINT
+    return buffer_ + size_;
+}
+
+template <class T, class Allocator, size_t K>
+std::reverse_iterator<typename Vector<T, Allocator, K>::Iterator> Vector<T, Allocator, K>::rbegin() {  //  NOLINT
+    return std::reverse_iterator<Iterator>(end());
+}
+
+template <class T, class Allocator, size_t K>
+std::reverse_iterator<typename Vector<T, Allocator, K>::Iterator> Vector<T, Allocator, K>::rend() {  //  NOLINT
+    return std::reverse_iterator<Iterator>(begin());
+}
+
+template <class T, class Allocator, size_t K>
+std::reverse_iterator<typename Vector<T, Allocator, K>::ConstIterator>
+Vector<T, Allocator, K>::rbegin() const {  //  NOLINT
+    return std::reverse_iterator<ConstIterator>(end());
+}
+
+template <class T, class Allocator, size_t K>
+std::reverse_iterator<typename Vector<T, Allocator, K>::ConstIterator>
+Vector<T, Allocator, K>::rend() const {  //  NOLINT
+    return std::reverse_iterator<ConstIterator>(begin());
+}
+
+template <class T, class Allocator, size_t K>
+typename Vector<T, Allocator, K>::Iterator Vector<T, Allocator, K>::Insert(ConstIterator position, const T& value) {
+    T copy(value);
+    return Insert(position, std::make_move_iterator(&copy), std::make_move_iterator(&copy + 1));
+}
+
+template <class T, class Allocator, size_t K>
+template <std::input_iterator InputIt>
+typename Vector<T, Allocator, K>::Iterator Vector<T, Allocator, K>::Insert(ConstIterator position, InputIt first,
+                                                                        InputIt last) {
+    size_t index = position - buffer_;
+    if constexpr (!MultiPassIterator<InputIt>) {
+        Vector<T, Allocator, K> tmp(allocator_);
+        for (; first != last; ++first) {
+            tmp.PushBack(*first);
+        }
+        return Insert(buffer_ + index, std::make_move_iterator(tmp.begin()), std::make_move_iterator(tmp.end()));
+    } else {
+        size_t count = std::distance(first, last);
+        if (count == 0) {
+            return buffer_ + index;
+        }
+        if (size_ + count > capacity_) {
+            size_t new_cap = Max(capacity_ * 2, size_ + count);
+            T* buffer = Allocate(new_cap);
+            size_t inserted = 0;
+            size_t before = 0;
+            size_t after = 0;
+            try {
+                for (; first != last; ++first, ++inserted) {
+                    AllocatorTraits::construct(allocator_, buffer + index + inserted, *first);
+                }
+                for (; before < index; ++before) {
+                    AllocatorTraits::construct(allocator_, buffer + before, std::move_if_noexcept(buffer_[before]));
+                }
+                for (; index + after < size_; ++after) {
+                    AllocatorTraits::construct(allocator_, buffer + index + count + after,
+                                               std::move_if_noexcept(buffer_[index + after]));
+                }
+            } catch (...) {
+                Destroy(buffer, buffer + before);
+                Destroy(buffer + index, buffer + index + inserted);
+                Destroy(buffer + index + count, buffer + index + count + after);
+                Deallocate(buffer, new_cap);
+                throw;
+            }
+            Destroy(buffer_, buffer_ + size_);
+            Deallocate(buffer_, capacity_);
+            buffer_ = buffer;
+            size_ += count;
+            capacity_ = new_cap;
+            return buffer_ + index;
+        }
+        T* pos = buffer_ + index;
+        T* old_end = buffer_ + size_;
+        size_t after = size_ - index;
+        if (after > count) {
+            for (T* from = old_end - count; from != old_end; ++from) {
+                AllocatorTraits::construct(allocator_, buffer_ + size_, std::move(*from));
+                ++size_;
+            }
+            std::move_backward(pos, old_end - count, old_end);
+            std::copy(first, last, pos);
+        } else {
+            InputIt middle = std::next(first, after);
+            for (InputIt it = middle; it != last; ++it) {
+                AllocatorTraits::construct(allocator_, buffer_ + size_, *it);
+                ++size_;
             }
-            if (buffer_[i] < other.buffer_[i]) {
-                return false;
+            for (T* from = pos; from != old_end; ++from) {
+                AllocatorTraits::construct(allocator_, buffer_ + size_, std::move(*from));
+                ++size_;
             }
-            continue;
+            std::copy(first, middle, pos);
         }
-        return (i < size_);
+        return pos;
     }
-    return false;
 }
 
-template <class T>
-bool Vector<T>::operator==(const Vector<T>& other) const {
-    size_t size = Max(size_, other.size_);
-    for (size_t i = 0; i < size; ++i) {
-        if (i < size_ && i < other.size_) {
-            if (buffer_[i] > other.buffer_[i]) {
-                return false;
-            }
-            if (buffer_[i] < other.buffer_[i]) {
-                return false;
-            }
-            continue;
+template <class T, class Allocator, size_t K>
+typename Vector<T, Allocator, K>::Iterator Vector<T, Allocator, K>::Erase(ConstIterator position) {
+    return Erase(position, position + 1);
+}
+
+template <class T, class Allocator, size_t K>
+typename Vector<T, Allocator, K>::Iterator Vector<T, Allocator, K>::Erase(ConstIterator first, ConstIterator last) {
+    T* from = buffer_ + (first - buffer_);
+    T* to = buffer_ + (last - buffer_);
+    if (from != to) {
+        T* new_end = std::move(to, buffer_ + size_, from);
+        Destroy(new_end, buffer_ + size_);
+        size_ = new_end - buffer_;
+    }
+    return from;
+}
+
+template <class T, class Allocator, size_t K>
+template <std::input_iterator InputIt>
+Vector<T, Allocator, K>& Vector<T, Allocator, K>::Assign(InputIt first, InputIt last) {
+    if constexpr (!MultiPassIterator<InputIt>) {
+        Clear();
+        for (; first != last; ++first) {
+            PushBack(*first);
+        }
+    } else {
+        size_t count = std::distance(first, last);
+        if (count > capacity_) {
+            Release();
+            buffer_ = Allocate(count);
+            capacity_ = count;
+        }
+        size_t common = count < size_ ? count : size_;
+        for (size_t i = 0; i < common; ++i, ++first) {
+            buffer_[i] = *first;
+        }
+        if (count < size_) {
+            Destroy(buffer_ + count, buffer_ + size_);
+            size_ = count;
+        }
+        for (; size_ < count; ++size_, ++first) {
+            AllocatorTraits::construct(allocator_, buffer_ + size_, *first);
         }
-        return false;
     }
-    return true;
+    return *this;
 }
 
-template <class T>
-bool Vector<T>::operator>=(const Vector<T>& other) const {
-    return (*this > other || *this == other);
+template <class T, class Allocator, size_t K>
+std::weak_ordering Vector<T, Allocator, K>::operator<=>(const Vector<T, Allocator, K>& other) const {
+    return LexicographicCompare(buffer_, size_, other.buffer_, other.size_);
 }
 
-template <class T>
-bool Vector<T>::operator<(const Vector<T>& other) const {
-    return !(*this >= other);
+template <class T, class Allocator, size_t K>
+bool Vector<T, Allocator, K>::operator>(const Vector<T, Allocator, K>& other) const {
+    return (*this <=> other) > 0;
 }
 
-template <class T>
-bool Vector<T>::operator<=(const Vector<T>& other) const {
-    return !(*this > other);
+template <class T, class Allocator, size_t K>
+bool Vector<T, Allocator, K>::operator==(const Vector<T, Allocator, K>& other) const {
+    return RangesEqual(buffer_, size_, other.buffer_, other.size_);
 }
 
-template <class T>
-bool Vector<T>::operator!=(const Vector<T>& other) const {
+template <class T, class Allocator, size_t K>
+bool Vector<T, Allocator, K>::operator>=(const Vector<T, Allocator, K>& other) const {
+    return (*this <=> other) >= 0;
+}
+
+template <class T, class Allocator, size_t K>
+bool Vector<T, Allocator, K>::operator<(const Vector<T, Allocator, K>& other) const {
+    return (*this <=> other) < 0;
+}
+
+template <class T, class Allocator, size_t K>
+bool Vector<T, Allocator, K>::operator<=(const Vector<T, Allocator, K>& other) const {
+    return (*this <=> other) <= 0;
+}
+
+template <class T, class Allocator, size_t K>
+bool Vector<T, Allocator, K>::operator!=(const Vector<T, Allocator, K>& other) const {
     return !(*this == other);
 }
 
-#endif  // VECTOR_VECTOR_H
\ No newline at end of file
+#endif  // VECTOR_VECTOR_H